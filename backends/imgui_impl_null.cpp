@@ -0,0 +1,142 @@
+// dear imgui: Null Platform+Renderer Backends
+// This is designed if you need to run a Dear ImGui context with no inputs and no graphics output (e.g. tests, benchmarks, headless tools).
+
+// Implemented features:
+//  [X] Platform: Fixed display size and delta time, for deterministic frames.
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures). Textures are acknowledged but never uploaded anywhere.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_null.h"
+#include <stdint.h>     // intptr_t
+
+//-----------------------------------------------------------------------------
+// Null Platform+Renderer
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplNull_Init()
+{
+    ImGui_ImplNullPlatform_Init();
+    ImGui_ImplNullRender_Init();
+    return true;
+}
+
+void    ImGui_ImplNull_Shutdown()
+{
+    ImGui_ImplNullRender_Shutdown();
+    ImGui_ImplNullPlatform_Shutdown();
+}
+
+void    ImGui_ImplNull_NewFrame()
+{
+    ImGui_ImplNullPlatform_NewFrame();
+    ImGui_ImplNullRender_NewFrame();
+}
+
+//-----------------------------------------------------------------------------
+// Null Platform
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplNullPlatform_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendPlatformName == nullptr && "Already initialized a platform backend!");
+    io.BackendPlatformName = "imgui_impl_null";
+    return true;
+}
+
+void    ImGui_ImplNullPlatform_Shutdown()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = nullptr;
+}
+
+// Display size may be set by the application, otherwise a default is provided. Time always advances by 1/60th of a second.
+void    ImGui_ImplNullPlatform_NewFrame()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    if (io.DisplaySize.x <= 0.0f || io.DisplaySize.y <= 0.0f)
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+}
+
+//-----------------------------------------------------------------------------
+// Null Renderer
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplNullRender_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererName == nullptr && "Already initialized a renderer backend!");
+    io.BackendRendererName = "imgui_impl_null";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;      // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    return true;
+}
+
+void    ImGui_ImplNullRender_Shutdown()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    // Destroy all textures
+    for (ImTextureData* tex : platform_io.Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+            ImGui_ImplNullRender_UpdateTexture(tex);
+        }
+
+    io.BackendRendererName = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    platform_io.ClearRendererHandlers();
+}
+
+void    ImGui_ImplNullRender_NewFrame()
+{
+}
+
+void    ImGui_ImplNullRender_RenderDrawData(ImDrawData* draw_data)
+{
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplNullRender_UpdateTexture(tex);
+}
+
+void    ImGui_ImplNullRender_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Any non-zero identifier will do
+        tex->SetTexID((ImTextureID)(intptr_t)(tex->UniqueID + 1));
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
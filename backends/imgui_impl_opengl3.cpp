@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Alpha8 textures (e.g. 'io.Fonts->TexDesiredFormat = ImTextureFormat_Alpha8') are stored as GL_R8 + swizzle on GL 3.3+/ES 3.0+, expanded to RGBA on upload otherwise.
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +24,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Support ImTextureFormat_Alpha8 textures: stored as single channel GL_R8 with a texture swizzle when available (GL 3.3+, ES 3.0+), otherwise expanded to RGBA at upload time.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
@@ -218,6 +220,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have GL_R8 textures and GL_TEXTURE_SWIZZLE_XXX parameters
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -249,6 +256,7 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasBindSampler;
     bool            HasClipOrigin;
+    bool            HasTextureSwizzle;       // Can store ImTextureFormat_Alpha8 textures as GL_R8
     bool            UseBufferSubData;
     ImVector<char>  TempBuffer;
 
@@ -401,6 +409,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 #endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     bd->HasBindSampler = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    bd->HasTextureSwizzle = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
@@ -721,8 +732,52 @@ static void ImGui_ImplOpenGL3_DestroyTexture(ImTextureData* tex)
     tex->SetStatus(ImTextureStatus_Destroyed);
 }
 
+// Copy a block of pixels into a contiguous buffer (as GL ES has no GL_UNPACK_ROW_LENGTH).
+// When 'expand_alpha8' is set, ImTextureFormat_Alpha8 pixels are expanded to white RGBA pixels (for contexts without GL_R8 + swizzle).
+static const void* ImGui_ImplOpenGL3_CopyTexturePixels(ImTextureData* tex, int x, int y, int w, int h, bool expand_alpha8)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int dst_pitch = w * (expand_alpha8 ? 4 : tex->BytesPerPixel);
+    bd->TempBuffer.resize(h * dst_pitch);
+    char* out_p = bd->TempBuffer.Data;
+    for (int yy = 0; yy < h; yy++, out_p += dst_pitch)
+    {
+        const unsigned char* src_p = (const unsigned char*)tex->GetPixelsAt(x, y + yy);
+        if (expand_alpha8)
+        {
+            for (int xx = 0; xx < w; xx++)
+            {
+                const unsigned int c = IM_COL32(255, 255, 255, src_p[xx]);
+                memcpy(out_p + xx * 4, &c, 4);
+            }
+        }
+        else
+        {
+            memcpy(out_p, src_p, dst_pitch);
+        }
+    }
+    IM_ASSERT(out_p == bd->TempBuffer.end());
+    return bd->TempBuffer.Data;
+}
+
 void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
 {
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+
+    // Alpha8 textures are uploaded as single channel GL_R8 + swizzle (1,1,1,R) when supported, halving upload bandwidth and GPU memory.
+    // Otherwise they are expanded to RGBA when uploading.
+    IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+    const bool expand_alpha8 = (tex->Format == ImTextureFormat_Alpha8 && !bd->HasTextureSwizzle);
+    GLint gl_internal_format = GL_RGBA;
+    GLenum gl_format = GL_RGBA;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (tex->Format == ImTextureFormat_Alpha8 && bd->HasTextureSwizzle)
+    {
+        gl_internal_format = GL_R8;
+        gl_format = GL_RED;
+    }
+#endif
+
     // FIXME: Consider backing up and restoring
     if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
     {
@@ -739,8 +794,7 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         // Create and upload new texture to graphics system
         //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
         IM_ASSERT(tex->TexID == 0 && tex->BackendUserData == nullptr);
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
-        const void* pixels = tex->GetPixels();
+        const void* pixels = expand_alpha8 ? ImGui_ImplOpenGL3_CopyTexturePixels(tex, 0, 0, tex->Width, tex->Height, true) : tex->GetPixels();
         GLuint gl_texture_id = 0;
 
         // Upload texture to graphics system
@@ -753,7 +807,18 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex->Width, tex->Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+        if (gl_format == GL_RED)
+        {
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+        }
+#endif
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, gl_internal_format, tex->Width, tex->Height, 0, gl_format, GL_UNSIGNED_BYTE, pixels));
+        if (expand_alpha8)
+            bd->TempBuffer.clear();
 
         // Store identifiers
         tex->SetTexID((ImTextureID)(intptr_t)gl_texture_id);
@@ -772,24 +837,20 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GLuint gl_tex_id = (GLuint)(intptr_t)tex->TexID;
         GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_tex_id));
 #if GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
-        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
-        for (ImTextureRect& r : tex->Updates)
-            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, tex->GetPixelsAt(r.x, r.y)));
-        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
-#else
-        // GL ES doesn't have GL_UNPACK_ROW_LENGTH, so we need to (A) copy to a contiguous buffer or (B) upload line by line.
-        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
-        for (ImTextureRect& r : tex->Updates)
+        if (!expand_alpha8)
         {
-            const int src_pitch = r.w * tex->BytesPerPixel;
-            bd->TempBuffer.resize(r.h * src_pitch);
-            char* out_p = bd->TempBuffer.Data;
-            for (int y = 0; y < r.h; y++, out_p += src_pitch)
-                memcpy(out_p, tex->GetPixelsAt(r.x, r.y + y), src_pitch);
-            IM_ASSERT(out_p == bd->TempBuffer.end());
-            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, bd->TempBuffer.Data));
+            GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
+            for (ImTextureRect& r : tex->Updates)
+                GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, gl_format, GL_UNSIGNED_BYTE, tex->GetPixelsAt(r.x, r.y)));
+            GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
         }
+        else
 #endif
+        {
+            // GL ES doesn't have GL_UNPACK_ROW_LENGTH, so we need to (A) copy to a contiguous buffer or (B) upload line by line.
+            for (ImTextureRect& r : tex->Updates)
+                GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, gl_format, GL_UNSIGNED_BYTE, ImGui_ImplOpenGL3_CopyTexturePixels(tex, r.x, r.y, r.w, r.h, expand_alpha8)));
+        }
         tex->SetStatus(ImTextureStatus_OK);
         GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture)); // Restore state
     }
@@ -0,0 +1,765 @@
+// Dear ImGui: headless benchmarks
+// Runs deterministic synthetic scenes with the null platform/renderer backend, and reports per-scene metrics in a machine-readable format.
+// - Output is one JSON object per line (default) or CSV with a header (--csv), on stdout. Notes and errors go to stderr.
+// - ns/frame is measured from NewFrame() to the end of RenderDrawData(). Allocations are counted by ImGuiDebugAllocInfo (requires debug tools).
+// - Vertices, indices and draw commands are taken from the draw data of the last frame (or the scene's own draw list, for render_text_xxx scenes).
+// - ns/op is reported by scenes timing individual operations (e.g. storage_xxx scenes: ImGuiStorage lookups, insertions, bulk builds).
+// - GB/s is reported by scenes processing pixels (texconv_xxx scenes: bytes read + bytes written by ImFontAtlasTextureBlockConvert()).
+// - Each scene runs in its own context, with 'warmup' frames which are not measured.
+// - When compiled with IMGUI_ENABLE_PROFILER, --trace saves measured frames of each scene to '<scene>.trace.json' (Chrome trace format).
+// Usage:
+//   ./imgui_benchmarks [--frames=N] [--warmup=N] [--csv] [--trace] [--cjk-font=path/to/font.ttf] [--list] [scene_name_filter...]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImTimeGetSeconds(), ImGuiDebugAllocInfo, ImTextCharToUtf8(), ImHashData(), ImFontAtlasTextureBlockConvert()
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef IMGUI_ENABLE_FREETYPE
+#include "misc/freetype/imgui_freetype.h"
+#include <thread>
+#include <vector>
+#endif
+
+#ifndef IMGUI_BENCH_FONTS_DIR
+#define IMGUI_BENCH_FONTS_DIR "../misc/fonts"
+#endif
+
+//-----------------------------------------------------------------------------
+// Benchmark state
+//-----------------------------------------------------------------------------
+
+struct BenchOptions
+{
+    int                 Frames = 60;
+    int                 Warmup = 5;
+    bool                OutputCsv = false;
+    bool                Trace = false;
+    const char*         CjkFontPath = NULL;
+};
+
+struct BenchState
+{
+    const BenchOptions* Options = NULL;
+    ImFont*             Font = NULL;            // Font used by scene (default font unless loaded by scene Init function)
+    ImGuiTextBuffer     Text;                   // Scene text
+    ImVector<int>       TextLineOffsets;        // Offsets of paragraphs/lines in Text
+    ImVector<ImVec2>    Points;                 // Polylines points
+    ImVector<ImWchar>   Codepoints;             // Codepoints for glyph churn
+    ImDrawList*         DrawList = NULL;        // Owned draw list for RenderText() measurements
+    ImVec4              ClipRect;
+    double              GlyphsCount = 0.0;      // Glyphs submitted to RenderText() during measured frames
+    double              GlyphsTime = 0.0;       // Time spent in RenderText() during measured frames
+    ImGuiStorage        Storage;                // Storage for storage_xxx scenes
+    ImGuiStorage        StorageBase;            // Initial contents of Storage, restored before each batch of insertions
+    ImVector<ImGuiID>   StorageKeys;            // Keys in StorageBase
+    ImVector<ImGuiID>   StorageNewKeys;         // Keys not in StorageBase, for insertions
+    unsigned int        StorageChecksum = 0;    // Sum of looked up values, so lookups can't be optimized out
+    double              OpsCount = 0.0;         // Operations timed by scene during measured frames
+    double              OpsTime = 0.0;          // Time spent in those operations
+    ImVector<ImU8>      SrcPixels;              // Source and destination pixels for texconv_xxx scenes
+    ImVector<ImU8>      DstPixels;
+    double              BytesCount = 0.0;       // Bytes read + written by scene during measured frames
+    double              BytesTime = 0.0;        // Time spent reading/writing those
+    int                 SceneArgs[2] = {};      // Copy of BenchScene::Args[]
+    bool                Measuring = false;
+};
+
+struct BenchScene
+{
+    const char*         Name;
+    void                (*Init)(BenchState* bs);    // Optional, called after context creation, before first frame
+    void                (*Frame)(BenchState* bs, int frame_n);
+    int                 Args[2];                    // Optional scene parameters
+};
+
+// Deterministic pseudo-random numbers (LCG)
+static unsigned int BenchRand(unsigned int* seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+// Generate lines of words, optionally with non-ASCII characters
+static void BenchGenerateText(ImGuiTextBuffer* out_text, ImVector<int>* out_line_offsets, int lines_count, int words_per_line, bool mixed_utf8, unsigned int seed)
+{
+    static const ImWchar extra_chars[] = { 0xE9, 0xE8, 0xE0, 0xFC, 0xDF, 0xB0, 0x3A9, 0x416, 0x2026, 0x20AC };
+    for (int line_n = 0; line_n < lines_count; line_n++)
+    {
+        out_line_offsets->push_back(out_text->size());
+        for (int word_n = 0; word_n < words_per_line; word_n++)
+        {
+            char word[64];
+            char* p = word;
+            const int len = 2 + BenchRand(&seed) % 9;
+            for (int n = 0; n < len; n++)
+            {
+                if (mixed_utf8 && BenchRand(&seed) % 4 == 0)
+                    p += ImTextCharToUtf8(p, extra_chars[BenchRand(&seed) % IM_ARRAYSIZE(extra_chars)]);
+                else
+                    *p++ = (char)('a' + BenchRand(&seed) % 26);
+            }
+            *p++ = (word_n + 1 < words_per_line) ? ' ' : '\n';
+            out_text->append(word, p);
+        }
+    }
+}
+
+// Full-screen window without decorations, so content size doesn't depend on style
+static void BenchBeginFullscreenWindow(const char* name, ImGuiWindowFlags flags = 0)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings | flags);
+}
+
+//-----------------------------------------------------------------------------
+// Scenes: widgets, windows, tables
+//-----------------------------------------------------------------------------
+
+static void SceneButtons_Frame(BenchState*, int)
+{
+    BenchBeginFullscreenWindow("Buttons");
+    for (int n = 0; n < 10000; n++)
+    {
+        if (n % 10 != 0)
+            ImGui::SameLine();
+        ImGui::PushID(n);
+        ImGui::Button("Button");
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static void SceneTable_Frame(BenchState*, int frame_n)
+{
+    const int rows_count = 100000;
+    BenchBeginFullscreenWindow("Table");
+    const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("table", 5, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Flag");
+        ImGui::TableSetupColumn("Action");
+        ImGui::TableHeadersRow();
+
+        // Jump to a different place every frame
+        ImGui::SetScrollY((float)((frame_n * 7919) % rows_count) * ImGui::GetTextLineHeightWithSpacing());
+        ImGuiListClipper clipper;
+        clipper.Begin(rows_count);
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                ImGui::PushID(row_n);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%06d", row_n);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Some item name");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", row_n * 0.125f);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted((row_n & 1) ? "Yes" : "No");
+                ImGui::TableNextColumn();
+                ImGui::SmallButton("Edit");
+                ImGui::PopID();
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+static void SceneWindows_Frame(BenchState*, int)
+{
+    for (int n = 0; n < 500; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %03d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n % 25) * 70), (float)((n / 25) * 50)));
+        ImGui::SetNextWindowSize(ImVec2(160.0f, 100.0f));
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Window %d", n);
+        ImGui::Button("OK");
+        ImGui::End();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Scenes: text
+//-----------------------------------------------------------------------------
+
+// ~4 MB of text in ~48k lines
+static void SceneTextUnformatted_Init(BenchState* bs)
+{
+    BenchGenerateText(&bs->Text, &bs->TextLineOffsets, 48 * 1024, 14, false, 1234);
+}
+
+static void SceneTextUnformatted_Frame(BenchState* bs, int frame_n)
+{
+    const int lines_count = bs->TextLineOffsets.Size;
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, (float)((frame_n * 104729) % lines_count) * ImGui::GetTextLineHeight()));
+    BenchBeginFullscreenWindow("TextUnformatted");
+    ImGui::TextUnformatted(bs->Text.begin(), bs->Text.end());
+    ImGui::End();
+}
+
+// Same text with a cached line index
+static void SceneTextAppendOnly_Frame(BenchState* bs, int frame_n)
+{
+    const int lines_count = bs->TextLineOffsets.Size;
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, (float)((frame_n * 104729) % lines_count) * ImGui::GetTextLineHeight()));
+    BenchBeginFullscreenWindow("TextUnformattedAppendOnly");
+    ImGui::TextUnformattedAppendOnly(bs->Text.begin(), bs->Text.end());
+    ImGui::End();
+}
+
+// Same, wrapped
+static void SceneTextAppendOnlyWrapped_Frame(BenchState* bs, int frame_n)
+{
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, (float)((frame_n * 104729) % bs->TextLineOffsets.Size) * ImGui::GetTextLineHeight()));
+    BenchBeginFullscreenWindow("TextUnformattedAppendOnlyWrapped");
+    ImGui::PushTextWrapPos(0.0f);
+    ImGui::TextUnformattedAppendOnly(bs->Text.begin(), bs->Text.end());
+    ImGui::PopTextWrapPos();
+    ImGui::End();
+}
+
+// 400 paragraphs of ~80 words
+// Args[0] = 0: unchanged text, 1: formatted text changing every frame, 2: wrap width changing every frame (e.g. resizing a window)
+static void SceneTextWrapped_Init(BenchState* bs)
+{
+    BenchGenerateText(&bs->Text, &bs->TextLineOffsets, 400, 80, false, 5678);
+}
+
+static void SceneTextWrapped_Frame(BenchState* bs, int frame_n)
+{
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, (float)((frame_n * 331) % 20000)));
+    BenchBeginFullscreenWindow("TextWrapped");
+    ImGui::PushTextWrapPos((bs->SceneArgs[0] == 2) ? 700.0f + (frame_n % 200) : 900.0f);
+    for (int n = 0; n < bs->TextLineOffsets.Size; n++)
+    {
+        const char* text_begin = bs->Text.begin() + bs->TextLineOffsets[n];
+        const char* text_end = (n + 1 < bs->TextLineOffsets.Size) ? bs->Text.begin() + bs->TextLineOffsets[n + 1] - 1 : bs->Text.end() - 1; // Exclude trailing '\n'
+        if (bs->SceneArgs[0] == 1)
+            ImGui::Text("%d %.*s", frame_n, (int)(text_end - text_begin), text_begin);
+        else
+            ImGui::TextUnformatted(text_begin, text_end);
+    }
+    ImGui::PopTextWrapPos();
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Scenes: ImDrawList
+//-----------------------------------------------------------------------------
+
+// 200 polylines of 128 points
+static void SceneDrawListPolylines_Init(BenchState* bs)
+{
+    for (int line_n = 0; line_n < 200; line_n++)
+        for (int point_n = 0; point_n < 128; point_n++)
+        {
+            const float x = 20.0f + point_n * 14.0f;
+            const float y = 20.0f + line_n * 5.0f + sinf(point_n * 0.15f + line_n * 0.35f) * 30.0f;
+            bs->Points.push_back(ImVec2(x, y));
+        }
+}
+
+static void SceneDrawListPolylines_Frame(BenchState* bs, int)
+{
+    BenchBeginFullscreenWindow("Canvas");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    for (int line_n = 0; line_n < 200; line_n++)
+    {
+        const ImU32 col = IM_COL32(50 + line_n, 255 - line_n, 128, 255);
+        const float thickness = (line_n & 1) ? 3.0f : 1.0f;
+        draw_list->AddPolyline(&bs->Points[line_n * 128], 128, col, (line_n % 4 == 0) ? ImDrawFlags_Closed : ImDrawFlags_None, thickness);
+    }
+    for (int n = 0; n < 50; n++)
+        draw_list->AddConvexPolyFilled(&bs->Points[n * 128], 32, IM_COL32(255, 255, 255, 32));
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Scenes: fonts
+//-----------------------------------------------------------------------------
+
+// Render text made of glyphs which have never been rendered before, as long as possible.
+// Uses a CJK font if provided with --cjk-font, otherwise the Latin Extended/Greek/Cyrillic ranges of DroidSans.ttf (with more sizes, to compensate for fewer glyphs).
+static void SceneGlyphChurn_Init(BenchState* bs)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const char* cjk_font_path = bs->Options->CjkFontPath;
+    bs->Font = (cjk_font_path != NULL) ? io.Fonts->AddFontFromFileTTF(cjk_font_path) : NULL;
+    if (bs->Font != NULL)
+    {
+        for (ImWchar c = 0x4E00; c < 0x9FA0; c++)
+            bs->Codepoints.push_back(c);
+        return;
+    }
+    if (cjk_font_path != NULL)
+        fprintf(stderr, "cjk_glyph_churn: failed to load '%s', using DroidSans.ttf.\n", cjk_font_path);
+    bs->Font = io.Fonts->AddFontFromFileTTF(IMGUI_BENCH_FONTS_DIR "/DroidSans.ttf");
+    if (bs->Font == NULL)
+    {
+        fprintf(stderr, "cjk_glyph_churn: failed to load '%s', using default font.\n", IMGUI_BENCH_FONTS_DIR "/DroidSans.ttf");
+        bs->Font = io.Fonts->Fonts[0];
+    }
+    for (ImWchar c = 0x0100; c < 0x0500; c++)
+        if (bs->Font->IsGlyphInFont(c))
+            bs->Codepoints.push_back(c);
+}
+
+static void SceneGlyphChurn_Frame(BenchState* bs, int frame_n)
+{
+    const int glyphs_per_frame = 128;
+    const int pool_size = bs->Codepoints.Size;
+    BenchBeginFullscreenWindow("Glyphs");
+    for (int line_n = 0; line_n < 4; line_n++)
+    {
+        // Walk through the codepoints pool, with a different size on each pass
+        const int cursor = frame_n * glyphs_per_frame + line_n * (glyphs_per_frame / 4);
+        const float size = 13.0f + (float)((cursor / pool_size) % 12);
+        char buf[(glyphs_per_frame / 4) * 4 + 1];
+        char* p = buf;
+        for (int n = 0; n < glyphs_per_frame / 4; n++)
+            p += ImTextCharToUtf8(p, bs->Codepoints[(cursor + n) % pool_size]);
+        *p = 0;
+        ImGui::PushFont(bs->Font, size);
+        ImGui::TextUnformatted(buf, p);
+        ImGui::PopFont();
+    }
+    ImGui::End();
+}
+
+// Measure ImFont::RenderText() alone, into an owned draw list: 64 lines of ~100 characters, 16 times per frame.
+static void SceneRenderText_Init(BenchState* bs, bool mixed_utf8, const ImVec4& clip_rect)
+{
+    BenchGenerateText(&bs->Text, &bs->TextLineOffsets, 64, 16, mixed_utf8, 4321);
+    bs->DrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    bs->ClipRect = clip_rect;
+}
+static void SceneRenderTextAscii_Init(BenchState* bs)     { SceneRenderText_Init(bs, false, ImVec4(0.0f, 0.0f, 1920.0f, 1080.0f)); }
+static void SceneRenderTextMixed_Init(BenchState* bs)     { SceneRenderText_Init(bs, true,  ImVec4(0.0f, 0.0f, 1920.0f, 1080.0f)); }
+static void SceneRenderTextClippedX_Init(BenchState* bs)  { SceneRenderText_Init(bs, false, ImVec4(0.0f, 0.0f, 100.0f, 1080.0f)); }
+static void SceneRenderTextClippedY_Init(BenchState* bs)  { SceneRenderText_Init(bs, false, ImVec4(0.0f, 0.0f, 1920.0f, 100.0f)); }
+
+static void SceneRenderText_Frame(BenchState* bs, int)
+{
+    ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    int glyphs_count = 0;
+    for (const char* p = bs->Text.begin(); p < bs->Text.end(); glyphs_count++)
+    {
+        unsigned int c;
+        p += ImTextCharFromUtf8(&c, p, bs->Text.end());
+    }
+
+    const double t0 = ImTimeGetSeconds();
+    for (int iteration = 0; iteration < 16; iteration++)
+    {
+        ImDrawList* draw_list = bs->DrawList;
+        draw_list->_ResetForNewFrame();
+        draw_list->PushClipRect(ImVec2(bs->ClipRect.x, bs->ClipRect.y), ImVec2(bs->ClipRect.z, bs->ClipRect.w));
+        draw_list->PushTexture(font->OwnerAtlas->TexRef);
+        font->RenderText(draw_list, font_size, ImVec2(10.0f, 10.0f), IM_COL32_WHITE, bs->ClipRect, bs->Text.begin(), bs->Text.end());
+    }
+    if (bs->Measuring)
+    {
+        bs->GlyphsTime += ImTimeGetSeconds() - t0;
+        bs->GlyphsCount += 16.0 * glyphs_count;
+    }
+}
+
+#ifdef IMGUI_ENABLE_FREETYPE
+
+// Run ImGuiFreeType::LoadGlyphs() jobs on one thread each
+static void BenchRunFreeTypeJobs(ImGuiFreeTypeJobFunc job_func, void* job_data, int jobs_count, void*)
+{
+    std::vector<std::thread> threads;
+    for (int job_n = 1; job_n < jobs_count; job_n++)
+        threads.emplace_back(job_func, job_data, job_n);
+    job_func(job_data, 0);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// Args[0] = number of jobs. Bulk load the glyphs of SceneGlyphChurn_Init() (CJK font if provided with --cjk-font) with ImGuiFreeType::LoadGlyphs().
+// Font bakes are discarded before each call (not measured), so every frame rasterizes and packs the same glyphs again.
+static void SceneLoadGlyphs_Init(BenchState* bs)
+{
+    SceneGlyphChurn_Init(bs);
+    if (bs->Codepoints.Size > 4096)
+        bs->Codepoints.resize(4096); // Keep one size of glyphs small enough for the atlas
+}
+
+static void SceneLoadGlyphs_Frame(BenchState* bs, int)
+{
+    ImFontAtlas* atlas = bs->Font->OwnerAtlas;
+    ImFontAtlasFontDiscardBakes(atlas, bs->Font, 0);
+    const ImWchar ranges[] = { bs->Codepoints[0], bs->Codepoints.back(), 0 };
+    const double t0 = ImTimeGetSeconds();
+    const int loaded_count = ImGuiFreeType::LoadGlyphs(bs->Font, 20.0f, ranges, bs->SceneArgs[0], BenchRunFreeTypeJobs);
+    const double t1 = ImTimeGetSeconds();
+    if (bs->Measuring)
+    {
+        bs->OpsTime += t1 - t0;
+        bs->OpsCount += loaded_count;
+    }
+    BenchBeginFullscreenWindow("Glyphs");
+    ImGui::PushFont(bs->Font, 20.0f);
+    ImGui::Text("%d glyphs loaded", loaded_count);
+    ImGui::PopFont();
+    ImGui::End();
+}
+
+#endif // #ifdef IMGUI_ENABLE_FREETYPE
+
+// Args[0] = 0: Alpha8 -> RGBA32, 1: RGBA32 -> Alpha8. Convert a 4096x4096 texture with ImFontAtlasTextureBlockConvert(), 4 times per frame.
+static void SceneTexConvert_Init(BenchState* bs)
+{
+    const int size = 4096;
+    const int src_bpp = (bs->SceneArgs[0] == 0) ? 1 : 4;
+    bs->SrcPixels.resize(size * size * src_bpp);
+    bs->DstPixels.resize(size * size * (5 - src_bpp));
+    unsigned int seed = 1234;
+    for (int n = 0; n < bs->SrcPixels.Size; n++)
+        bs->SrcPixels[n] = (ImU8)BenchRand(&seed);
+}
+
+static void SceneTexConvert_Frame(BenchState* bs, int)
+{
+    const int size = 4096;
+    const ImTextureFormat src_fmt = (bs->SceneArgs[0] == 0) ? ImTextureFormat_Alpha8 : ImTextureFormat_RGBA32;
+    const ImTextureFormat dst_fmt = (bs->SceneArgs[0] == 0) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+    const int src_bpp = ImTextureDataGetFormatBytesPerPixel(src_fmt);
+    const int dst_bpp = ImTextureDataGetFormatBytesPerPixel(dst_fmt);
+    const double t0 = ImTimeGetSeconds();
+    for (int iteration = 0; iteration < 4; iteration++)
+        ImFontAtlasTextureBlockConvert(bs->SrcPixels.Data, src_fmt, size * src_bpp, bs->DstPixels.Data, dst_fmt, size * dst_bpp, size, size);
+    const double t1 = ImTimeGetSeconds();
+    if (bs->Measuring)
+    {
+        bs->BytesTime += t1 - t0;
+        bs->BytesCount += 4.0 * size * size * (src_bpp + dst_bpp);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Scenes: ImGuiStorage
+//-----------------------------------------------------------------------------
+
+// Args[0] = number of keys, Args[1] = 1 to use the hash index (ImGuiStorage::SetHashIndex())
+static void SceneStorage_Init(BenchState* bs)
+{
+    const int keys_count = bs->SceneArgs[0];
+    unsigned int seed = 777;
+    for (int n = 0; n < keys_count; n++)
+    {
+        const unsigned int r = BenchRand(&seed);
+        bs->StorageKeys.push_back(ImHashData(&r, sizeof(r)));
+    }
+    for (int n = 0; n < 1000; n++)
+    {
+        const unsigned int r = BenchRand(&seed);
+        bs->StorageNewKeys.push_back(ImHashData(&r, sizeof(r), 1));
+    }
+    bs->StorageBase.SetHashIndex(bs->SceneArgs[1] != 0);
+    bs->StorageBase.Data.reserve(keys_count);
+    for (int n = 0; n < keys_count; n++)
+        bs->StorageBase.Data.push_back(ImGuiStoragePair(bs->StorageKeys[n], n));
+    bs->StorageBase.BuildSortByKey();
+    bs->Storage = bs->StorageBase;
+}
+
+// 100k random lookups of existing keys
+static void SceneStorageLookup_Frame(BenchState* bs, int frame_n)
+{
+    const int lookups_count = 100000;
+    unsigned int seed = (unsigned int)frame_n;
+    unsigned int checksum = 0;
+    const double t0 = ImTimeGetSeconds();
+    for (int n = 0; n < lookups_count; n++)
+        checksum += (unsigned int)bs->Storage.GetInt(bs->StorageKeys[BenchRand(&seed) % bs->StorageKeys.Size]);
+    const double t1 = ImTimeGetSeconds();
+    bs->StorageChecksum += checksum;
+    if (bs->Measuring)
+    {
+        bs->OpsTime += t1 - t0;
+        bs->OpsCount += lookups_count;
+    }
+}
+
+// 1000 insertions of new keys, starting from initial contents
+static void SceneStorageInsert_Frame(BenchState* bs, int)
+{
+    bs->Storage = bs->StorageBase; // Not measured. Reserve so we measure insertions, not a one-off growth of Data[].
+    bs->Storage.Data.reserve(bs->Storage.Data.Size + bs->StorageNewKeys.Size);
+    const double t0 = ImTimeGetSeconds();
+    for (int n = 0; n < bs->StorageNewKeys.Size; n++)
+        bs->Storage.SetInt(bs->StorageNewKeys[n], n);
+    const double t1 = ImTimeGetSeconds();
+    if (bs->Measuring)
+    {
+        bs->OpsTime += t1 - t0;
+        bs->OpsCount += bs->StorageNewKeys.Size;
+    }
+}
+
+// Bulk build: push all pairs then call BuildSortByKey()
+static void SceneStorageBulk_Frame(BenchState* bs, int)
+{
+    ImGuiStorage& storage = bs->Storage;
+    const double t0 = ImTimeGetSeconds();
+    storage.Data.resize(0);
+    for (int n = 0; n < bs->StorageKeys.Size; n++)
+        storage.Data.push_back(ImGuiStoragePair(bs->StorageKeys[n], n));
+    storage.BuildSortByKey();
+    const double t1 = ImTimeGetSeconds();
+    if (bs->Measuring)
+    {
+        bs->OpsTime += t1 - t0;
+        bs->OpsCount += bs->StorageKeys.Size;
+    }
+}
+
+static const BenchScene g_Scenes[] =
+{
+    { "buttons_10k",                NULL,                         SceneButtons_Frame,           { 0, 0 } },
+    { "table_100k_clipped",         NULL,                         SceneTable_Frame,             { 0, 0 } },
+    { "windows_500",                NULL,                         SceneWindows_Frame,           { 0, 0 } },
+    { "text_unformatted_4mb",       SceneTextUnformatted_Init,    SceneTextUnformatted_Frame,   { 0, 0 } },
+    { "text_append_only_4mb",       SceneTextUnformatted_Init,    SceneTextAppendOnly_Frame,    { 0, 0 } },
+    { "text_append_wrapped_4mb",    SceneTextUnformatted_Init,    SceneTextAppendOnlyWrapped_Frame, { 0, 0 } },
+    { "text_wrapped_wall",          SceneTextWrapped_Init,        SceneTextWrapped_Frame,       { 0, 0 } },
+    { "text_wrapped_formatted",     SceneTextWrapped_Init,        SceneTextWrapped_Frame,       { 1, 0 } },
+    { "text_wrapped_resizing",      SceneTextWrapped_Init,        SceneTextWrapped_Frame,       { 2, 0 } },
+    { "drawlist_polylines",         SceneDrawListPolylines_Init,  SceneDrawListPolylines_Frame, { 0, 0 } },
+    { "cjk_glyph_churn",            SceneGlyphChurn_Init,         SceneGlyphChurn_Frame,        { 0, 0 } },
+#ifdef IMGUI_ENABLE_FREETYPE
+    { "load_glyphs_1_job",          SceneLoadGlyphs_Init,         SceneLoadGlyphs_Frame,        { 1, 0 } },
+    { "load_glyphs_4_jobs",         SceneLoadGlyphs_Init,         SceneLoadGlyphs_Frame,        { 4, 0 } },
+#endif
+    { "render_text_ascii",          SceneRenderTextAscii_Init,    SceneRenderText_Frame,        { 0, 0 } },
+    { "render_text_mixed",          SceneRenderTextMixed_Init,    SceneRenderText_Frame,        { 0, 0 } },
+    { "render_text_clipped_x",      SceneRenderTextClippedX_Init, SceneRenderText_Frame,        { 0, 0 } },
+    { "render_text_clipped_y",      SceneRenderTextClippedY_Init, SceneRenderText_Frame,        { 0, 0 } },
+    { "texconv_4096_a8_to_rgba32",  SceneTexConvert_Init,         SceneTexConvert_Frame,        { 0, 0 } },
+    { "texconv_4096_rgba32_to_a8",  SceneTexConvert_Init,         SceneTexConvert_Frame,        { 1, 0 } },
+    { "storage_1k_sorted_lookup",   SceneStorage_Init,            SceneStorageLookup_Frame,     { 1000, 0 } },
+    { "storage_1k_hash_lookup",     SceneStorage_Init,            SceneStorageLookup_Frame,     { 1000, 1 } },
+    { "storage_100k_sorted_lookup", SceneStorage_Init,            SceneStorageLookup_Frame,     { 100000, 0 } },
+    { "storage_100k_hash_lookup",   SceneStorage_Init,            SceneStorageLookup_Frame,     { 100000, 1 } },
+    { "storage_1m_sorted_lookup",   SceneStorage_Init,            SceneStorageLookup_Frame,     { 1000000, 0 } },
+    { "storage_1m_hash_lookup",     SceneStorage_Init,            SceneStorageLookup_Frame,     { 1000000, 1 } },
+    { "storage_1k_sorted_insert",   SceneStorage_Init,            SceneStorageInsert_Frame,     { 1000, 0 } },
+    { "storage_1k_hash_insert",     SceneStorage_Init,            SceneStorageInsert_Frame,     { 1000, 1 } },
+    { "storage_100k_sorted_insert", SceneStorage_Init,            SceneStorageInsert_Frame,     { 100000, 0 } },
+    { "storage_100k_hash_insert",   SceneStorage_Init,            SceneStorageInsert_Frame,     { 100000, 1 } },
+    { "storage_1m_sorted_insert",   SceneStorage_Init,            SceneStorageInsert_Frame,     { 1000000, 0 } },
+    { "storage_1m_hash_insert",     SceneStorage_Init,            SceneStorageInsert_Frame,     { 1000000, 1 } },
+    { "storage_1k_sorted_bulk",     SceneStorage_Init,            SceneStorageBulk_Frame,       { 1000, 0 } },
+    { "storage_1k_hash_bulk",       SceneStorage_Init,            SceneStorageBulk_Frame,       { 1000, 1 } },
+    { "storage_100k_sorted_bulk",   SceneStorage_Init,            SceneStorageBulk_Frame,       { 100000, 0 } },
+    { "storage_100k_hash_bulk",     SceneStorage_Init,            SceneStorageBulk_Frame,       { 100000, 1 } },
+    { "storage_1m_sorted_bulk",     SceneStorage_Init,            SceneStorageBulk_Frame,       { 1000000, 0 } },
+    { "storage_1m_hash_bulk",       SceneStorage_Init,            SceneStorageBulk_Frame,       { 1000000, 1 } },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchResult
+{
+    int                 Frames;
+    double              NsPerFrameMean;
+    double              NsPerFrameMedian;
+    double              NsPerFrameMin;
+    double              AllocsPerFrame;
+    int                 Vertices;
+    int                 Indices;
+    int                 DrawCmds;
+    int                 DrawLists;
+    double              GlyphsPerSec;       // 0.0 when not measured by scene
+    double              NsPerOp;            // 0.0 when not measured by scene
+    double              GBPerSec;           // 0.0 when not measured by scene
+};
+
+static int BenchCompareDoubles(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs;
+    const double b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void BenchRunScene(const BenchScene* scene, const BenchOptions* options, BenchResult* out_result)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    ImGui_ImplNull_Init();
+    io.Fonts->AddFontDefault();
+
+    BenchState bs;
+    bs.Options = options;
+    bs.Font = io.Fonts->Fonts[0];
+    bs.SceneArgs[0] = scene->Args[0];
+    bs.SceneArgs[1] = scene->Args[1];
+    if (scene->Init)
+        scene->Init(&bs);
+
+    ImVector<double> frame_times;
+    int allocs_count = 0;
+    for (int frame_n = 0; frame_n < options->Warmup + options->Frames; frame_n++)
+    {
+        bs.Measuring = (frame_n >= options->Warmup);
+        ctx->Profiler.Enabled = options->Trace && bs.Measuring;
+        const int allocs_count_before = ctx->DebugAllocInfo.TotalAllocCount;
+        const double t0 = ImTimeGetSeconds();
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        scene->Frame(&bs, frame_n);
+        ImGui::Render();
+        ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+        const double t1 = ImTimeGetSeconds();
+        if (bs.Measuring)
+        {
+            frame_times.push_back((t1 - t0) * 1e9);
+            allocs_count += ctx->DebugAllocInfo.TotalAllocCount - allocs_count_before;
+        }
+    }
+
+    memset(out_result, 0, sizeof(*out_result));
+    out_result->Frames = frame_times.Size;
+    if (bs.DrawList != NULL)
+    {
+        // Scene rendered into its own draw list
+        out_result->Vertices = bs.DrawList->VtxBuffer.Size;
+        out_result->Indices = bs.DrawList->IdxBuffer.Size;
+        out_result->DrawCmds = bs.DrawList->CmdBuffer.Size;
+        out_result->DrawLists = 1;
+    }
+    else
+    {
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        out_result->Vertices = draw_data->TotalVtxCount;
+        out_result->Indices = draw_data->TotalIdxCount;
+        out_result->DrawLists = draw_data->CmdListsCount;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            out_result->DrawCmds += draw_list->CmdBuffer.Size;
+    }
+    if (frame_times.Size > 0)
+    {
+        double total = 0.0;
+        for (double t : frame_times)
+            total += t;
+        qsort(frame_times.Data, (size_t)frame_times.Size, sizeof(double), BenchCompareDoubles);
+        out_result->NsPerFrameMean = total / frame_times.Size;
+        out_result->NsPerFrameMedian = frame_times[frame_times.Size / 2];
+        out_result->NsPerFrameMin = frame_times[0];
+        out_result->AllocsPerFrame = (double)allocs_count / frame_times.Size;
+    }
+    if (bs.GlyphsTime > 0.0)
+        out_result->GlyphsPerSec = bs.GlyphsCount / bs.GlyphsTime;
+    if (bs.OpsCount > 0.0)
+        out_result->NsPerOp = bs.OpsTime * 1e9 / bs.OpsCount;
+    if (bs.BytesTime > 0.0)
+        out_result->GBPerSec = bs.BytesCount / bs.BytesTime / 1e9;
+
+    if (options->Trace)
+    {
+        char filename[128];
+        snprintf(filename, IM_ARRAYSIZE(filename), "%s.trace.json", scene->Name);
+        if (!ImGui::ProfilerSaveChromeTrace(filename))
+            fprintf(stderr, "%s: failed to save '%s'.\n", scene->Name, filename);
+    }
+    if (bs.DrawList)
+        IM_DELETE(bs.DrawList);
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext(ctx);
+}
+
+static bool BenchSceneMatchFilters(const char* name, int filters_count, char** filters)
+{
+    if (filters_count == 0)
+        return true;
+    for (int n = 0; n < filters_count; n++)
+        if (strstr(name, filters[n]) != NULL)
+            return true;
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    // Parse command-line
+    BenchOptions options;
+    char** filters = (char**)malloc(sizeof(char*) * (size_t)argc);
+    int filters_count = 0;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        const char* arg = argv[arg_n];
+        if (strncmp(arg, "--frames=", 9) == 0)
+            options.Frames = ImMax(1, atoi(arg + 9));
+        else if (strncmp(arg, "--warmup=", 9) == 0)
+            options.Warmup = ImMax(0, atoi(arg + 9));
+        else if (strcmp(arg, "--csv") == 0)
+            options.OutputCsv = true;
+        else if (strcmp(arg, "--trace") == 0)
+            options.Trace = true;
+        else if (strncmp(arg, "--cjk-font=", 11) == 0)
+            options.CjkFontPath = arg + 11;
+        else if (strcmp(arg, "--list") == 0)
+        {
+            for (const BenchScene& scene : g_Scenes)
+                printf("%s\n", scene.Name);
+            free(filters);
+            return 0;
+        }
+        else if (arg[0] == '-')
+        {
+            fprintf(stderr, "Usage: %s [--frames=N] [--warmup=N] [--csv] [--trace] [--cjk-font=path/to/font.ttf] [--list] [scene_name_filter...]\n", argv[0]);
+            free(filters);
+            return 1;
+        }
+        else
+            filters[filters_count++] = argv[arg_n];
+    }
+#ifdef IMGUI_DISABLE_DEBUG_TOOLS
+    fprintf(stderr, "Note: compiled with IMGUI_DISABLE_DEBUG_TOOLS, allocations are not counted.\n");
+#endif
+#ifndef IMGUI_ENABLE_PROFILER
+    if (options.Trace)
+        fprintf(stderr, "Note: compiled without IMGUI_ENABLE_PROFILER (use 'make PROFILER=1'), traces will be empty.\n");
+#endif
+
+    // Run scenes
+    if (options.OutputCsv)
+        printf("scene,frames,ns_per_frame_mean,ns_per_frame_median,ns_per_frame_min,allocs_per_frame,vertices,indices,draw_cmds,draw_lists,glyphs_per_sec,ns_per_op,gb_per_sec\n");
+    for (const BenchScene& scene : g_Scenes)
+    {
+        if (!BenchSceneMatchFilters(scene.Name, filters_count, filters))
+            continue;
+        BenchResult r;
+        BenchRunScene(&scene, &options, &r);
+        if (options.OutputCsv)
+            printf("%s,%d,%.0f,%.0f,%.0f,%.2f,%d,%d,%d,%d,%.0f,%.1f,%.2f\n",
+                scene.Name, r.Frames, r.NsPerFrameMean, r.NsPerFrameMedian, r.NsPerFrameMin, r.AllocsPerFrame, r.Vertices, r.Indices, r.DrawCmds, r.DrawLists, r.GlyphsPerSec, r.NsPerOp, r.GBPerSec);
+        else
+            printf("{\"scene\":\"%s\",\"frames\":%d,\"ns_per_frame_mean\":%.0f,\"ns_per_frame_median\":%.0f,\"ns_per_frame_min\":%.0f,\"allocs_per_frame\":%.2f,\"vertices\":%d,\"indices\":%d,\"draw_cmds\":%d,\"draw_lists\":%d,\"glyphs_per_sec\":%.0f,\"ns_per_op\":%.1f,\"gb_per_sec\":%.2f}\n",
+                scene.Name, r.Frames, r.NsPerFrameMean, r.NsPerFrameMedian, r.NsPerFrameMin, r.AllocsPerFrame, r.Vertices, r.Indices, r.DrawCmds, r.DrawLists, r.GlyphsPerSec, r.NsPerOp, r.GBPerSec);
+        fflush(stdout);
+    }
+    free(filters);
+    return 0;
+}
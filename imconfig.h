@@ -55,6 +55,10 @@
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
 
+//---- Make the current context pointer (GImGui) thread_local, so that N threads may each use their own context concurrently.
+// Contexts may share a font atlas across threads with 'atlas->Flags |= ImFontAtlasFlags_ThreadShared'. Not supported when building Dear ImGui as a DLL with MSVC.
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -66,16 +70,18 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use a faster word-at-a-time hash for IDs instead of CRC32c. This will change all IDs, invalidating existing .ini data.
+// Constant IDs obtained with ImHashStrConst() follow the same setting. Cannot be combined with IMGUI_USE_LEGACY_CRC32_ADLER.
+//#define IMGUI_USE_FAST_HASH
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of Dear ImGui sources files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
-//#define IMGUI_STB_RECT_PACK_FILENAME  "my_folder/stb_rect_pack.h"
 //#define IMGUI_STB_SPRINTF_FILENAME    "my_folder/stb_sprintf.h"    // only used if IMGUI_USE_STB_SPRINTF is defined.
 //#define IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-//#define IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 //#define IMGUI_DISABLE_STB_SPRINTF_IMPLEMENTATION                   // only disabled if IMGUI_USE_STB_SPRINTF is defined.
 
 //---- Use stb_sprintf.h for a faster implementation of vsnprintf instead of the one from libc (unless IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS is defined)
@@ -138,6 +144,10 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Enable built-in CPU profiler zones (NewFrame, Begin/End per window, tables layout, text rendering, font atlas update, Render).
+// Recording is enabled from 'Metrics->Profiler', which displays a flame view and can export a Chrome trace (.json).
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
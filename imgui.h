@@ -184,6 +184,7 @@ struct ImFontConfig;                // Configuration data when adding a font or
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImFontLoader;                // Opaque interface to a font loading backend (stb_truetype, FreeType etc.).
+struct ImFontSharedData;            // Opaque reference-counted read-only font data, may be shared by multiple atlases and contexts (see ImGui::CreateFontSharedDataFromFile())
 struct ImTextureData;               // Specs and pixel storage for a texture used by Dear ImGui.
 struct ImTextureRect;               // Coordinates of a rectangle within a texture.
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
@@ -194,6 +195,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiMousePosSample;         // Raw mouse position sample, see GetMousePosSamples().
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -612,6 +614,7 @@ namespace ImGui
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
+    IMGUI_API void          TextUnformattedAppendOnly(const char* text, const char* text_end = NULL); // [EXPERIMENTAL] same as TextUnformatted() for a large buffer which is only appended to or cleared between frames (e.g. a log). Keeps a line index and a copy of the text keyed by buffer address: only new and visible lines are processed, including when wrapping. Other modifications are detected but lay out the whole text again.
     IMGUI_API void          Text(const char* fmt, ...)                                      IM_FMTARGS(1); // formatted text
     IMGUI_API void          TextV(const char* fmt, va_list args)                            IM_FMTLIST(1);
     IMGUI_API void          TextColored(const ImVec4& col, const char* fmt, ...)            IM_FMTARGS(2); // shortcut for PushStyleColor(ImGuiCol_Text, col); Text(fmt, ...); PopStyleColor();
@@ -1100,6 +1103,7 @@ namespace ImGui
     IMGUI_API bool          IsAnyMouseDown();                                                   // [WILL OBSOLETE] is any mouse button held? This was designed for backends, but prefer having backend maintain a mask of held mouse buttons, because upcoming input queue system will make this invalid.
     IMGUI_API ImVec2        GetMousePos();                                                      // shortcut to ImGui::GetIO().MousePos provided by user, to be consistent with other calls
     IMGUI_API ImVec2        GetMousePosOnOpeningCurrentPopup();                                 // retrieve mouse position at the time of opening popup we have BeginPopup() into (helper to avoid user backing that value themselves)
+    IMGUI_API int           GetMousePosSamples(const ImGuiMousePosSample** out_samples);        // retrieve raw mouse positions processed by this frame, in submission order: unrounded, timestamped, including those merged/filtered by the input queue. Useful for e.g. drawing applications.
     IMGUI_API bool          IsMouseDragging(ImGuiMouseButton button, float lock_threshold = -1.0f);         // is mouse dragging? (uses io.MouseDraggingThreshold if lock_threshold < 0.0f)
     IMGUI_API ImVec2        GetMouseDragDelta(ImGuiMouseButton button = 0, float lock_threshold = -1.0f);   // return the delta from the initial clicking position while the mouse button is pressed or was just released. This is locked and return 0.0f until the mouse moves past a distance threshold at least once (uses io.MouseDraggingThreshold if lock_threshold < 0.0f)
     IMGUI_API void          ResetMouseDragDelta(ImGuiMouseButton button = 0);                   //
@@ -1141,6 +1145,17 @@ namespace ImGui
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
 
+    // Shared Font Data
+    // - [EXPERIMENTAL] Read-only, reference-counted font file data which may be used by multiple font sources, atlases and contexts, from multiple threads.
+    // - Those functions are not reliant on the current context.
+    // - Files are memory-mapped when supported (Windows, POSIX): pages are loaded on demand and shared with other mappings of the same file.
+    //   The file must not be modified or truncated while mapped. Other platforms or builds with IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS load the file into memory.
+    // - Each font source added with ImFontAtlas::AddFontFromSharedData() holds a reference, released on RemoveFont()/Clear(). Call ReleaseFontSharedData() when you are done with yours.
+    IMGUI_API ImFontSharedData* CreateFontSharedDataFromFile(const char* filename);                      // Return NULL on failure. Reference count starts at 1.
+    IMGUI_API ImFontSharedData* CreateFontSharedDataFromMemory(const void* font_data, int font_data_size); // Copy data. Reference count starts at 1.
+    IMGUI_API void          AddRefFontSharedData(ImFontSharedData* shared_data);
+    IMGUI_API void          ReleaseFontSharedData(ImFontSharedData* shared_data);                       // Free data when reference count reaches zero.
+
 } // namespace ImGui
 
 //-----------------------------------------------------------------------------
@@ -1268,6 +1283,7 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_CallbackCharFilter  = 1 << 21,  // Callback on character inputs to replace or discard them. Modify 'EventChar' to replace or discard, or return 1 in callback to discard.
     ImGuiInputTextFlags_CallbackResize      = 1 << 22,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
     ImGuiInputTextFlags_CallbackEdit        = 1 << 23,  // Callback on any edit. Note that InputText() already returns true on edit + you can always use IsItemEdited(). The callback is useful to manipulate the underlying buffer while focus is active.
+    ImGuiInputTextFlags_CallbackEditStream  = 1 << 25,  // [EXPERIMENTAL] Edit-stream API: while active, 'buf' is not compared/written back every frame. Instead each frame's edits are sent to callback as a replaced range (EditPos/EditDeleteLen/EditInsertLen) to apply to your own storage. 'buf' is only read on activation and while inactive, and 'buf_size' doesn't limit text length. Only the notification side: InputText() still keeps the text in one contiguous buffer (no rope/piece table storage), so an edit still moves the text following it.
 
     // Multi-line Word-Wrapping [BETA]
     // - Not well tested yet. Please report any incorrect cursor movement, selection behavior etc. bug to https://github.com/ocornut/imgui/issues/3237.
@@ -2376,6 +2392,15 @@ struct ImGuiKeyData
     float       AnalogValue;        // 0.0f..1.0f for gamepad values
 };
 
+// Raw mouse position sample, as submitted to io.AddMousePosEvent(). See GetMousePosSamples().
+struct ImGuiMousePosSample
+{
+    ImVec2              Pos;            // Position, not rounded. (-FLT_MAX, -FLT_MAX) if mouse is unavailable.
+    double              Timestamp;      // Time of submission, in seconds, from a high resolution monotonic clock with an arbitrary origin. 0.0 if unsupported on this platform.
+    ImGuiMouseSource    MouseSource;    // Mouse, TouchScreen or Pen. See io.AddMouseSourceEvent().
+    unsigned int        EventId;        // [Internal] Input event this sample was merged into.
+};
+
 struct ImGuiIO
 {
     //------------------------------------------------------------------
@@ -2389,6 +2414,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        IniSavingBinary;                // = false          // [EXPERIMENTAL] Save .ini data in a compact binary format (not human-readable). Loading always accepts both formats.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2411,6 +2437,7 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // Swap Cmd<>Ctrl keys + OS X style text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseEvents; // = true           // Merge consecutive mouse move events and consecutive mouse wheel events in the input queue. This doesn't change the resulting io state. Individual mouse positions are still available with GetMousePosSamples().
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
@@ -2638,6 +2665,9 @@ struct ImGuiInputTextCallbackData
     int                 CursorPos;      //                                      // Read-write   // [Completion,History,Always]
     int                 SelectionStart; //                                      // Read-write   // [Completion,History,Always] == to SelectionEnd when no selection
     int                 SelectionEnd;   //                                      // Read-write   // [Completion,History,Always]
+    int                 EditPos;        // Start of replaced range (in bytes)   // Read-only    // [EditStream] Bytes [EditPos, EditPos+EditDeleteLen) of previous text were replaced with Buf[EditPos, EditPos+EditInsertLen).
+    int                 EditDeleteLen;  // Length of removed text (in bytes)    // Read-only    // [EditStream]
+    int                 EditInsertLen;  // Length of inserted text (in bytes)   // Read-only    // [EditStream]
 
     // Helper functions for text manipulation.
     // Use those function to benefit from the CallbackResize behaviors. Calling those function reset the selection.
@@ -2764,6 +2794,7 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// For large storages with frequent insertions, an optional hash index may be enabled with SetHashIndex(true).
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2772,11 +2803,12 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<int>                   HashIndex;      // Optional open-addressing hash table: index+1 into Data[], 0 for empty slots. Empty when not enabled.
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    IMGUI_API void      Clear();
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2797,6 +2829,14 @@ struct ImGuiStorage
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+
+    // Advanced: optional hash index, for large storages (e.g. thousands of tree nodes) or storages with frequent insertions.
+    // - Queries and insertions become O(1) instead of O(log N) queries and O(N) insertions, for 8-16 extra bytes per pair.
+    // - When enabled, pairs in Data[] are kept in insertion order, NOT sorted by key! Disabling sorts them back.
+    // - After modifying Data[] directly (e.g. bulk building with Data.push_back()), call BuildSortByKey() which rebuilds the index in this mode.
+    // - A window's own storage automatically enables it once holding more than a few hundred pairs.
+    IMGUI_API void      SetHashIndex(bool enabled);
+    bool                HasHashIndex() const { return HashIndex.Size > 0; }
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -3519,6 +3559,7 @@ struct ImFontConfig
     void*           FontData;               //          // TTF/OTF data
     int             FontDataSize;           //          // TTF/OTF data size
     bool            FontDataOwnedByAtlas;   // true     // TTF/OTF data ownership taken by the owner ImFontAtlas (will delete memory itself).
+    ImFontSharedData* FontSharedData;       // NULL     // [EXPERIMENTAL] Shared TTF/OTF data (see ImGui::CreateFontSharedDataFromFile()). AddFont() takes a reference and sets FontData/FontDataSize from it.
 
     // Options
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
@@ -3557,11 +3598,13 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
+    unsigned int    PageIdx : 5;        // Index of atlas texture page holding the glyph pixels. Always 0 unless using ImFontAtlas::TexPageWidth/TexPageHeight.
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef (or page texture if PageIdx != 0). Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
+    int             LastUsedFrame;      // [Internal] Last frame this glyph was returned by FindGlyph(). Used for least-recently-used eviction (see ImFontAtlas::MemoryBudget).
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
 };
@@ -3606,6 +3649,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_ThreadShared       = 1 << 3,   // [EXPERIMENTAL] Atlas is used by contexts running in different threads (see IMGUI_ENABLE_THREAD_LOCAL_CONTEXT). Read comments below.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3627,6 +3671,18 @@ enum ImFontAtlasFlags_
 //   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
 // - This is an old API and it is currently awkward for those and various other reasons! We will address them in the future!
+// Sharing an atlas between contexts running in different threads: (ImFontAtlasFlags_ThreadShared) [EXPERIMENTAL]
+//  - Add fonts and set the flag before other threads start using the atlas. Requires a renderer with ImGuiBackendFlags_RendererHasTextures.
+//  - Each context holds a read lock on the atlas from NewFrame() until its next NewFrame(), as its draw data refers to atlas textures and glyphs.
+//    Call ImGui::UnlockFontAtlases() once your renderer backend is done with the draw data to release it earlier. The atlas is modified by its
+//    owner context's NewFrame() (or by your own call to ImFontAtlasUpdateNewFrame() if you created the atlas), which waits for all read locks.
+//  - The lock is not reentrant. When running several contexts sharing the atlas on a same thread: don't nest their frames, and call
+//    ImGui::UnlockFontAtlases() after rendering each of them, otherwise the atlas update will deadlock (asserts with IMGUI_ENABLE_THREAD_LOCAL_CONTEXT).
+//  - Glyphs and font sizes which are missing when a context needs them are requested, and baked by the next ImFontAtlasUpdateNewFrame() call.
+//    Until then, the fallback glyph and the closest baked size are used.
+//  - Atlas textures are only listed in the owner context's platform_io.Textures[]. If you created the atlas (atlas->OwnerContext == NULL), no context
+//    lists them: after each ImFontAtlasUpdateNewFrame() call, pass atlas->TexList[] to your renderer backend yourself, from the thread which called it.
+//  - All contexts using the atlas must use the same rasterizer density.
 struct ImFontAtlas
 {
     IMGUI_API ImFontAtlas();
@@ -3637,6 +3693,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
+    IMGUI_API ImFont*           AddFontFromSharedData(ImFontSharedData* shared_data, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // [EXPERIMENTAL] Atlas takes its own reference to 'shared_data'. See ImGui::CreateFontSharedDataFromFile().
     IMGUI_API void              RemoveFont(ImFont* font);
 
     IMGUI_API void              Clear();                    // Clear everything (input fonts, output glyphs/textures).
@@ -3723,6 +3780,9 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexPageWidth;       // [EXPERIMENTAL] Fixed texture page width. Must be a power of two. Default to 0 (disabled). Requires ImGuiBackendFlags_RendererHasTextures.
+    int                         TexPageHeight;      // [EXPERIMENTAL] Fixed texture page height. When set, a new texture page is added when atlas is full, instead of growing and copying the whole texture.
+    int                         MemoryBudget;       // [EXPERIMENTAL] Maximum resident memory in bytes for textures and baked fonts data. Default to 0 (no limit). When exceeded, least recently used glyphs are evicted instead of growing textures.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
     // Output
@@ -3736,7 +3796,7 @@ struct ImFontAtlas
     ImTextureData*              TexData;            // Latest texture.
 
     // [Internal]
-    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
+    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back() unless using texture pages. DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
@@ -3778,14 +3838,15 @@ struct ImFontAtlas
 // Important: pointers to ImFontBaked are only valid for the current frame.
 struct ImFontBaked
 {
-    // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    // [Internal] Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<ImU16>             IndexPageMap;       // 12-16 // out // Two-level index: IndexPageMap[c >> 8] is the page number in IndexAdvanceX[]/IndexLookup[] for code-point 'c'. Page 0 is a shared empty page.
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
 
     // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Paged. Index glyphs by Unicode code-point, 256 code-points per page (see IndexPageMap).
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
@@ -3799,6 +3860,7 @@ struct ImFontBaked
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     OwnerFont;          // 4-8   // in  // Parent font
     void*                       FontLoaderDatas;    // 4-8   //     // Font loader opaque storage (per baked font * sources): single contiguous buffer allocated by imgui, passed to loader.
+    ImVector<ImU16>             GlyphsFreeList;     // 12-16 //     // Index of evicted entries in Glyphs[], reused by next loaded glyph.
 
     // Functions
     IMGUI_API ImFontBaked();
@@ -3842,6 +3904,8 @@ struct ImFont
     ImU8                        Used8kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/8192/8]; // 1 bytes if ImWchar=ImWchar16, 16 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
     bool                        EllipsisAutoBake;   // 1     //     // Mark when the "..." glyph needs to be generated.
     ImGuiStorage                RemapPairs;         // 16    //     // Remapping pairs when using AddRemapChar(), otherwise empty.
+    ImVector<ImU16>             SourceMapPages;     // 16    // out // Two-level map: SourceMapPages[c >> 8] is the page number in SourceMap[] for code-point 'c'. Page 0 is a shared unresolved page.
+    ImVector<ImU8>              SourceMap;          // 16    // out // Paged. Index+1 of first source providing code-point 'c', resolved once and shared by all baked sizes. 0 = unresolved, 0xFF = not provided by any source.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     float                       Scale;              // 4     // in  // Legacy base font scale (~1.0f), multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
 #endif
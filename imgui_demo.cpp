@@ -3876,6 +3876,41 @@ static void DemoWindowWidgetsTextInput()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Edit Stream Callback");
+        if (ImGui::TreeNode("Edit Stream Callback"))
+        {
+            HelpMarker(
+                "Using ImGuiInputTextFlags_CallbackEditStream to apply edits to your own storage.\n\n"
+                "While active, the buffer passed to InputText() is not compared or written back every frame: "
+                "each frame's edits are sent as a replaced range instead. Your storage only needs to be flattened "
+                "into a buffer when activating the widget.\n\n"
+                "This is only an edit-stream API: InputText() still keeps its own copy of the text in a contiguous buffer.");
+            struct Funcs
+            {
+                static int MyEditStreamCallback(ImGuiInputTextCallbackData* data)
+                {
+                    if (data->EventFlag == ImGuiInputTextFlags_CallbackEditStream)
+                    {
+                        // Replace [EditPos, EditPos + EditDeleteLen) in our storage with data->Buf[EditPos, EditPos + EditInsertLen).
+                        // Here we use a simple ImVector<char> (zero-terminated), but this is where you would update your own data structure.
+                        ImVector<char>* my_doc = (ImVector<char>*)data->UserData;
+                        my_doc->erase(my_doc->begin() + data->EditPos, my_doc->begin() + data->EditPos + data->EditDeleteLen);
+                        for (int n = 0; n < data->EditInsertLen; n++)
+                            my_doc->insert(my_doc->begin() + data->EditPos + n, data->Buf[data->EditPos + n]);
+                    }
+                    return 0;
+                }
+            };
+            static ImVector<char> my_doc;
+            static int edit_count = 0;
+            if (my_doc.empty())
+                my_doc.push_back(0);
+            if (ImGui::InputTextMultiline("##MyDoc", my_doc.begin(), (size_t)my_doc.size(), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 8), ImGuiInputTextFlags_CallbackEditStream, Funcs::MyEditStreamCallback, (void*)&my_doc))
+                edit_count++;
+            ImGui::Text("Size: %d, Edited frames: %d", my_doc.size() - 1, edit_count);
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Eliding, Alignment");
         if (ImGui::TreeNode("Eliding, Alignment"))
         {
@@ -9550,6 +9585,7 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Text("Printing unusually long amount of text.");
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
+        "Single call to TextUnformattedAppendOnly()\0"
         "Multiple calls to Text(), clipped\0"
         "Multiple calls to Text(), not clipped (slow)\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
@@ -9569,6 +9605,10 @@ static void ShowExampleAppLongText(bool* p_open)
         ImGui::TextUnformatted(log.begin(), log.end());
         break;
     case 1:
+        // Same, keeping a line index of the buffer: only appended and visible lines are processed
+        ImGui::TextUnformattedAppendOnly(log.begin(), log.end());
+        break;
+    case 2:
         {
             // Multiple calls to Text(), manually coarsely clipped - demonstrate how to use the ImGuiListClipper helper.
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
@@ -9580,7 +9620,7 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::PopStyleVar();
             break;
         }
-    case 2:
+    case 3:
         // Multiple calls to Text(), not clipped (slow)
         ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
         for (int i = 0; i < lines; i++)
@@ -12,7 +12,7 @@ Index of this file:
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
 // [SECTION] Helpers ShadeVertsXXX functions
-// [SECTION] ImFontConfig
+// [SECTION] ImFontConfig, ImFontSharedData
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
 // [SECTION] ImFontAtlas: backend for stb_truetype
 // [SECTION] ImFontAtlas: glyph ranges helpers
@@ -84,15 +84,13 @@ Index of this file:
 #endif
 
 //-------------------------------------------------------------------------
-// [SECTION] STB libraries implementation (for stb_truetype and stb_rect_pack)
+// [SECTION] STB libraries implementation (for stb_truetype)
 //-------------------------------------------------------------------------
 
 // Compile time options:
 //#define IMGUI_STB_NAMESPACE           ImStb
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
-//#define IMGUI_STB_RECT_PACK_FILENAME  "my_folder/stb_rect_pack.h"
 //#define IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-//#define IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 
 #ifdef IMGUI_STB_NAMESPACE
 namespace IMGUI_STB_NAMESPACE
@@ -102,9 +100,7 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef _MSC_VER
 #pragma warning (push)
 #pragma warning (disable: 4456)                             // declaration of 'xx' hides previous local declaration
-#pragma warning (disable: 6011)                             // (stb_rectpack) Dereferencing NULL pointer 'cur->next'.
 #pragma warning (disable: 6385)                             // (stb_truetype) Reading invalid data from 'buffer':  the readable size is '_Old_3`kernel_width' bytes, but '3' bytes may be read.
-#pragma warning (disable: 28182)                            // (stb_rectpack) Dereferencing NULL pointer. 'cur' contains the same NULL value as 'cur->next' did.
 #endif
 
 #if defined(__clang__)
@@ -120,20 +116,6 @@ namespace IMGUI_STB_NAMESPACE
 #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"     // warning: this statement may fall through
 #endif
 
-#ifndef STB_RECT_PACK_IMPLEMENTATION                        // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
-#ifndef IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION          // in case the user already have an implementation in another compilation unit
-#define STBRP_STATIC
-#define STBRP_ASSERT(x)     do { IM_ASSERT(x); } while (0)
-#define STBRP_SORT          ImQsort
-#define STB_RECT_PACK_IMPLEMENTATION
-#endif
-#ifdef IMGUI_STB_RECT_PACK_FILENAME
-#include IMGUI_STB_RECT_PACK_FILENAME
-#else
-#include "imstb_rectpack.h"
-#endif
-#endif
-
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
@@ -2405,7 +2387,7 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImFontConfig
+// [SECTION] ImFontConfig, ImFontSharedData
 //-----------------------------------------------------------------------------
 
 // FIXME-NEWATLAS: Oversample specification could be more dynamic. For now, favoring automatic selection.
@@ -2421,6 +2403,64 @@ ImFontConfig::ImFontConfig()
     EllipsisChar = 0;
 }
 
+// Files are mapped read-only when supported, so that multiple atlases, contexts and processes using the same font file share its pages.
+ImFontSharedData* ImGui::CreateFontSharedDataFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    bool is_mapped = true;
+    void* data = ImFileMap(filename, &data_size);
+    if (data == NULL)
+    {
+        is_mapped = false;
+        data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    }
+    if (data == NULL)
+        return NULL;
+    if (data_size > 0x7FFFFFFF) // FontDataSize is an int
+    {
+        if (is_mapped)
+            ImFileUnmap(data, data_size);
+        else
+            IM_FREE(data);
+        return NULL;
+    }
+    ImFontSharedData* shared_data = IM_NEW(ImFontSharedData)();
+    shared_data->Data = data;
+    shared_data->DataSize = (int)data_size;
+    shared_data->IsMapped = is_mapped;
+    shared_data->RefCount = 1;
+    return shared_data;
+}
+
+ImFontSharedData* ImGui::CreateFontSharedDataFromMemory(const void* font_data, int font_data_size)
+{
+    IM_ASSERT(font_data != NULL && font_data_size > 0);
+    ImFontSharedData* shared_data = IM_NEW(ImFontSharedData)();
+    shared_data->Data = ImMemdup(font_data, (size_t)font_data_size);
+    shared_data->DataSize = font_data_size;
+    shared_data->IsMapped = false;
+    shared_data->RefCount = 1;
+    return shared_data;
+}
+
+void ImGui::AddRefFontSharedData(ImFontSharedData* shared_data)
+{
+    IM_ASSERT(shared_data->RefCount > 0);
+    ImAtomicAdd(&shared_data->RefCount, +1);
+}
+
+void ImGui::ReleaseFontSharedData(ImFontSharedData* shared_data)
+{
+    IM_ASSERT(shared_data->RefCount > 0);
+    if (ImAtomicAdd(&shared_data->RefCount, -1) > 0)
+        return;
+    if (shared_data->IsMapped)
+        ImFileUnmap(shared_data->Data, (size_t)shared_data->DataSize);
+    else
+        IM_FREE(shared_data->Data);
+    IM_DELETE(shared_data);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImTextureData
 //-----------------------------------------------------------------------------
@@ -2500,6 +2540,11 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlas::ClearFonts()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasUpdateNewFrame()
+// - ImFontAtlasLockShared(), ImFontAtlasUnlockShared()
+// - ImFontAtlasLockExclusive(), ImFontAtlasUnlockExclusive()
+// - ImFontAtlasIsSharedReadOnly()
+// - ImFontAtlasBuildProcessSharedRequests()
+// - ImFontAtlasBuildSetupSharedReaders()
 // - ImFontAtlasTextureBlockConvert()
 // - ImFontAtlasTextureBlockPostProcess()
 // - ImFontAtlasTextureBlockPostProcessMultiply()
@@ -2515,6 +2560,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlas::AddFontDefault()
 // - ImFontAtlas::AddFontFromFileTTF()
 // - ImFontAtlas::AddFontFromMemoryTTF()
+// - ImFontAtlas::AddFontFromSharedData()
 // - ImFontAtlas::AddFontFromMemoryCompressedTTF()
 // - ImFontAtlas::AddFontFromMemoryCompressedBase85TTF()
 // - ImFontAtlas::RemoveFont()
@@ -2543,6 +2589,8 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildDiscardFontBakedGlyph()
 // - ImFontAtlasBuildDiscardFontBaked()
 // - ImFontAtlasBuildDiscardFontBakes()
+// - ImFontAtlasBuildEvictGlyphs()
+// - ImFontAtlasBuildUpdateMemoryBudget()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasAddDrawListSharedData()
 // - ImFontAtlasRemoveDrawListSharedData()
@@ -2551,6 +2599,7 @@ void ImTextureData::DestroyPixels()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasBuildSetTexture()
 // - ImFontAtlasBuildAddTexture()
+// - ImFontAtlasTextureAddPage()
 // - ImFontAtlasBuildMakeSpace()
 // - ImFontAtlasBuildRepackTexture()
 // - ImFontAtlasBuildGrowTexture()
@@ -2566,11 +2615,15 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasPackDiscardRect()
 // - ImFontAtlasPackAddRect()
 // - ImFontAtlasPackGetRect()
+// - ImFontAtlasPackGetFragmentation()
+// - ImFontAtlasPackDefragStep()
 //-----------------------------------------------------------------------------
-// - ImFontBaked_BuildGrowIndex()
+// - ImFontAtlasFontResolveSource()
+// - ImFontBaked_BuildGetIndexSlot()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
+// - ImFontAtlasStbTrueTypeGetCmapCacheInfo()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
 //-----------------------------------------------------------------------------
@@ -2630,6 +2683,17 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 #define IM_FONTGLYPH_INDEX_UNUSED           ((ImU16)-1) // 0xFFFF
 #define IM_FONTGLYPH_INDEX_NOT_FOUND        ((ImU16)-2) // 0xFFFE
 
+// ImFontBaked index is split in pages of 256 code-points, allocated on demand: IndexXXX[(IndexPageMap[c >> 8] << 8) + (c & 0xFF)]
+#define IM_FONTBAKED_INDEX_PAGE_SHIFT       8
+#define IM_FONTBAKED_INDEX_PAGE_SIZE        (1 << IM_FONTBAKED_INDEX_PAGE_SHIFT)
+#define IM_FONTBAKED_INDEX_PAGE_MASK        (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)
+#define IM_FONTBAKED_INDEX_SLOT(_BAKED, _C) (((int)(_BAKED)->IndexPageMap.Data[(_C) >> IM_FONTBAKED_INDEX_PAGE_SHIFT] << IM_FONTBAKED_INDEX_PAGE_SHIFT) + ((_C) & IM_FONTBAKED_INDEX_PAGE_MASK))
+
+// ImFont::SourceMap[] uses the same paging. Stored values are source index + 1.
+#define IM_FONTSOURCE_MAP_UNRESOLVED        0
+#define IM_FONTSOURCE_MAP_NOT_FOUND         0xFF
+#define IM_FONTSOURCE_MAP_MAX_SOURCES       (IM_FONTSOURCE_MAP_NOT_FOUND - 1)
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
@@ -2736,12 +2800,23 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
         }
 }
 
+static void ImFontAtlasBuildProcessSharedRequests(ImFontAtlas* atlas);
+static void ImFontAtlasBuildSetupSharedReaders(ImFontAtlas* atlas);
+static void ImFontAtlasBuildSetupFontBakedFallback(ImFontBaked* baked);
+
 // Called by NewFrame() for atlases owned by a context.
 // If you manually manage font atlases, you'll need to call this yourself.
 // - 'frame_count' needs to be provided because we can gc/prioritize baked fonts based on their age.
 // - 'frame_count' may not match those of all imgui contexts using this atlas, as contexts may be updated as different frequencies. But generally you can use ImGui::GetFrameCount() on one of your context.
+// - With ImFontAtlasFlags_ThreadShared, this waits until no context holds a read lock (see ImFontAtlasLockShared()), then bakes glyphs and sizes they requested.
+//   If you created the atlas, no context lists its textures in platform_io.Textures[]: process atlas->TexList[] after this call.
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
+    IMGUI_PROFILER_SCOPE("ImFontAtlasUpdateNewFrame");
+    const bool thread_shared = (atlas->Flags & ImFontAtlasFlags_ThreadShared) && atlas->Builder != NULL;
+    if (thread_shared)
+        ImFontAtlasLockExclusive(atlas);
+
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
     atlas->RendererHasTextures = renderer_has_textures;
 
@@ -2765,6 +2840,10 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
 
+    // Bake glyphs and sizes requested by contexts using a thread-shared atlas
+    if (thread_shared)
+        ImFontAtlasBuildProcessSharedRequests(atlas);
+
     // Garbage collect BakedPool
     if (builder->BakedDiscardedCount > 0)
     {
@@ -2785,6 +2864,13 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         builder->BakedDiscardedCount = 0;
     }
 
+    // Memory budget and incremental defragmentation of texture
+    if (atlas->RendererHasTextures)
+    {
+        ImFontAtlasBuildUpdateMemoryBudget(atlas);
+        ImFontAtlasPackDefragStep(atlas, builder->DefragPixelBudget);
+    }
+
     // Update texture status
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
@@ -2839,6 +2925,157 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    if (thread_shared)
+    {
+        ImFontAtlasBuildSetupSharedReaders(atlas);
+        ImFontAtlasUnlockExclusive(atlas);
+    }
+}
+
+// Readers/writer lock for ImFontAtlasFlags_ThreadShared.
+// - Contexts hold a read lock from NewFrame() to next NewFrame() or ImGui::UnlockFontAtlases(), ImFontAtlasUpdateNewFrame() and atlas registration take the write lock.
+// - Writers have priority: new readers wait while a writer is waiting, so the atlas gets updated as soon as running frames are done.
+// - This is a spin lock (yielding), we expect writers to wait for at most one frame and readers for the duration of an atlas update.
+// - The lock is not reentrant: a thread holding a read lock deadlocks if it takes the write lock, or another read lock while a writer is waiting.
+//   e.g. nested frames of two contexts sharing the atlas, or updating the atlas while a context of the same thread didn't call ImGui::UnlockFontAtlases().
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+static IM_THREAD_LOCAL ImFontAtlas* GImFontAtlasReadLocked[8];          // Atlases read-locked by current thread, to assert on re-entrance
+static IM_THREAD_LOCAL int          GImFontAtlasReadLockedCount = 0;
+
+static int ImFontAtlasFindReadLockedByThread(ImFontAtlas* atlas)
+{
+    for (int n = 0; n < GImFontAtlasReadLockedCount; n++)
+        if (GImFontAtlasReadLocked[n] == atlas)
+            return n;
+    return -1;
+}
+#endif
+
+void ImFontAtlasLockShared(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT_USER_ERROR(builder != NULL, "Add fonts before using an atlas with ImFontAtlasFlags_ThreadShared!");
+#ifdef IMGUI_ATOMICS_UNSUPPORTED
+    IM_ASSERT_USER_ERROR(0, "ImFontAtlasFlags_ThreadShared requires atomics, which are not implemented for this compiler (see ImAtomicXXX helpers in imgui_internal.h)!");
+#endif
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    IM_ASSERT_USER_ERROR(ImFontAtlasFindReadLockedByThread(atlas) == -1, "This thread already holds a read lock on this atlas: nested frames of contexts sharing an atlas would deadlock!");
+    if (GImFontAtlasReadLockedCount < IM_ARRAYSIZE(GImFontAtlasReadLocked))
+        GImFontAtlasReadLocked[GImFontAtlasReadLockedCount++] = atlas;
+#endif
+    while (true)
+    {
+        if (ImAtomicLoad(&builder->SharedLockWritersWaiting) == 0)
+        {
+            const int state = ImAtomicLoad(&builder->SharedLockState);
+            if (state >= 0 && ImAtomicCompareExchange(&builder->SharedLockState, state, state + 1))
+                return;
+        }
+        ImThreadYield();
+    }
+}
+
+void ImFontAtlasUnlockShared(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(ImAtomicLoad(&builder->SharedLockState) > 0);
+    ImAtomicAdd(&builder->SharedLockState, -1);
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    const int n = ImFontAtlasFindReadLockedByThread(atlas);
+    if (n != -1)
+        GImFontAtlasReadLocked[n] = GImFontAtlasReadLocked[--GImFontAtlasReadLockedCount];
+#endif
+}
+
+void ImFontAtlasLockExclusive(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT_USER_ERROR(builder != NULL, "Add fonts before using an atlas with ImFontAtlasFlags_ThreadShared!");
+#ifdef IMGUI_ATOMICS_UNSUPPORTED
+    IM_ASSERT_USER_ERROR(0, "ImFontAtlasFlags_ThreadShared requires atomics, which are not implemented for this compiler (see ImAtomicXXX helpers in imgui_internal.h)!");
+#endif
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    IM_ASSERT_USER_ERROR(ImFontAtlasFindReadLockedByThread(atlas) == -1, "This thread holds a read lock on this atlas and would deadlock: call ImGui::UnlockFontAtlases() after rendering contexts sharing it on this thread!");
+#endif
+    ImAtomicAdd(&builder->SharedLockWritersWaiting, +1);
+    while (!ImAtomicCompareExchange(&builder->SharedLockState, 0, -1))
+        ImThreadYield();
+    ImAtomicAdd(&builder->SharedLockWritersWaiting, -1);
+}
+
+void ImFontAtlasUnlockExclusive(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(ImAtomicLoad(&builder->SharedLockState) == -1);
+    ImAtomicStore(&builder->SharedLockState, 0);
+}
+
+// Return true when atlas may not be modified: thread-shared atlas and caller doesn't hold the write lock.
+// When a context is within a frame (holding a read lock), no other thread may hold the write lock.
+bool ImFontAtlasIsSharedReadOnly(ImFontAtlas* atlas)
+{
+    return (atlas->Flags & ImFontAtlasFlags_ThreadShared) && atlas->Builder != NULL && ImAtomicLoadRelaxed(&atlas->Builder->SharedLockState) != -1;
+}
+
+// Record a glyph or size missed by a reader. Duplicates are ignored until the requests are processed.
+static void ImFontAtlasSharedRequestAdd(ImFontAtlas* atlas, ImFont* font, float size, float rasterizer_density, unsigned int codepoint)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasSharedRequest req;
+    memset(&req, 0, sizeof(req)); // Clear padding, we hash the whole struct
+    req.Font = font;
+    req.Size = size;
+    req.RasterizerDensity = rasterizer_density;
+    req.Codepoint = codepoint;
+    const ImGuiID req_hash = ImHashData(&req, sizeof(req));
+
+    while (!ImAtomicCompareExchange(&builder->SharedRequestsLock, 0, 1))
+        ImThreadYield();
+    int* p_requested = builder->SharedRequestsMap.GetIntRef(req_hash, 0);
+    if (*p_requested == 0)
+    {
+        *p_requested = 1;
+        builder->SharedRequests.push_back(req);
+    }
+    ImAtomicStore(&builder->SharedRequestsLock, 0);
+}
+
+// Called with the write lock held, readers are not running.
+static void ImFontAtlasBuildProcessSharedRequests(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (atlas->RendererHasTextures) // Legacy backends can't update texture: keep using closest sizes and fallback glyphs.
+        for (const ImFontAtlasSharedRequest& req : builder->SharedRequests)
+        {
+            if (!atlas->Fonts.contains(req.Font)) // Font may have been removed since
+                continue;
+            ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, req.Font, req.Size, req.RasterizerDensity);
+            baked->LastUsedFrame = builder->FrameCount;
+            if (req.Codepoint != 0)
+                baked->FindGlyph((ImWchar)req.Codepoint);
+        }
+    builder->SharedRequests.resize(0);
+    builder->SharedRequestsMap.Data.resize(0);
+}
+
+// Called with the write lock held, to setup what readers can't setup lazily.
+// - Each font has at least one baked size, so ImFontAtlasBakedGetClosestMatch() never fails.
+// - Each baked font has its fallback glyph, so FindGlyph() never needs to create it.
+static void ImFontAtlasBuildSetupSharedReaders(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    for (ImFont* font : atlas->Fonts)
+        if (font->Sources.Size > 0)
+            font->GetFontBaked(font->LegacySize > 0.0f ? font->LegacySize : IMGUI_FONT_SIZE_DEFAULT); // Same size as UpdateFontsNewFrame() picks for the default font
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (!baked->WantDestroy && baked->FallbackGlyphIndex == -1)
+            ImFontAtlasBuildSetupFontBakedFallback(baked);
+    }
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -2856,7 +3093,23 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
         {
             const ImU8* src_p = (const ImU8*)src_pixels;
             ImU32* dst_p = (ImU32*)(void*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
+            int nx = w;
+#ifdef IMGUI_ENABLE_SSE2
+            // 16 pixels at a time: move each alpha byte to the top of a 32-bit lane, then OR white.
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i white = _mm_set1_epi32((int)IM_COL32(255, 255, 255, 0));
+            for (; nx >= 16; nx -= 16, src_p += 16, dst_p += 16)
+            {
+                const __m128i a = _mm_loadu_si128((const __m128i*)(const void*)src_p);
+                const __m128i a_lo = _mm_unpacklo_epi8(zero, a);
+                const __m128i a_hi = _mm_unpackhi_epi8(zero, a);
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 0),  _mm_or_si128(_mm_unpacklo_epi16(zero, a_lo), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 4),  _mm_or_si128(_mm_unpackhi_epi16(zero, a_lo), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 8),  _mm_or_si128(_mm_unpacklo_epi16(zero, a_hi), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 12), _mm_or_si128(_mm_unpackhi_epi16(zero, a_hi), white));
+            }
+#endif
+            for (; nx > 0; nx--)
                 *dst_p++ = IM_COL32(255, 255, 255, (unsigned int)(*src_p++));
         }
     }
@@ -2866,7 +3119,19 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
         {
             const ImU32* src_p = (const ImU32*)(void*)src_pixels;
             ImU8* dst_p = (ImU8*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
+            int nx = w;
+#ifdef IMGUI_ENABLE_SSE2
+            // 16 pixels at a time: shift alpha down to the bottom of each 32-bit lane, then narrow (values are <= 255 so saturation is a no-op).
+            for (; nx >= 16; nx -= 16, src_p += 16, dst_p += 16)
+            {
+                const __m128i a0 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 0)), IM_COL32_A_SHIFT);
+                const __m128i a1 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 4)), IM_COL32_A_SHIFT);
+                const __m128i a2 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 8)), IM_COL32_A_SHIFT);
+                const __m128i a3 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 12)), IM_COL32_A_SHIFT);
+                _mm_storeu_si128((__m128i*)(void*)dst_p, _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3)));
+            }
+#endif
+            for (; nx > 0; nx--)
                 *dst_p++ = ((*src_p++) >> IM_COL32_A_SHIFT) & 0xFF;
         }
     }
@@ -2889,12 +3154,35 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
 {
     unsigned char* pixels = (unsigned char*)data->Pixels;
     int pitch = data->Pitch;
+#ifdef IMGUI_ENABLE_SSE2
+    // Clamping before truncation gives the same results as the scalar path, for a positive factor.
+    const __m128 factor_v = _mm_set1_ps(multiply_factor);
+    const __m128 max_v = _mm_set1_ps(255.0f);
+#endif
     if (data->Format == ImTextureFormat_Alpha8)
     {
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
         {
             ImU8* p = (ImU8*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
+            int nx = data->Width;
+#ifdef IMGUI_ENABLE_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            for (; nx >= 16; nx -= 16, p += 16)
+            {
+                const __m128i v = _mm_loadu_si128((const __m128i*)(void*)p);
+                const __m128i v_lo = _mm_unpacklo_epi8(v, zero);
+                const __m128i v_hi = _mm_unpackhi_epi8(v, zero);
+                __m128i r[4];
+                r[0] = _mm_unpacklo_epi16(v_lo, zero);
+                r[1] = _mm_unpackhi_epi16(v_lo, zero);
+                r[2] = _mm_unpacklo_epi16(v_hi, zero);
+                r[3] = _mm_unpackhi_epi16(v_hi, zero);
+                for (int n = 0; n < 4; n++)
+                    r[n] = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_cvtepi32_ps(r[n]), factor_v), max_v));
+                _mm_storeu_si128((__m128i*)(void*)p, _mm_packus_epi16(_mm_packs_epi32(r[0], r[1]), _mm_packs_epi32(r[2], r[3])));
+            }
+#endif
+            for (; nx > 0; nx--, p++)
             {
                 unsigned int v = ImMin((unsigned int)(*p * multiply_factor), (unsigned int)255);
                 *p = (unsigned char)v;
@@ -2906,7 +3194,17 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
         {
             ImU32* p = (ImU32*)(void*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
+            int nx = data->Width;
+#ifdef IMGUI_ENABLE_SSE2
+            const __m128i rgb_mask = _mm_set1_epi32((int)~IM_COL32_A_MASK);
+            for (; nx >= 4; nx -= 4, p += 4)
+            {
+                const __m128i v = _mm_loadu_si128((const __m128i*)(void*)p);
+                const __m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, IM_COL32_A_SHIFT)), factor_v), max_v));
+                _mm_storeu_si128((__m128i*)(void*)p, _mm_or_si128(_mm_and_si128(v, rgb_mask), _mm_slli_epi32(a, IM_COL32_A_SHIFT)));
+            }
+#endif
+            for (; nx > 0; nx--, p++)
             {
                 unsigned int a = ImMin((unsigned int)(((*p >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
                 *p = IM_COL32((*p >> IM_COL32_R_SHIFT) & 0xFF, (*p >> IM_COL32_G_SHIFT) & 0xFF, (*p >> IM_COL32_B_SHIFT) & 0xFF, a);
@@ -2933,7 +3231,13 @@ void ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, i
         for (int y = 0; y < h; y++)
         {
             ImU32* p = (ImU32*)(void*)dst_tex->GetPixelsAt(dst_x, dst_y + y);
-            for (int x = w; x > 0; x--, p++)
+            int x = w;
+#ifdef IMGUI_ENABLE_SSE2
+            const __m128i col_v = _mm_set1_epi32((int)col);
+            for (; x >= 4; x -= 4, p += 4)
+                _mm_storeu_si128((__m128i*)(void*)p, col_v);
+#endif
+            for (; x > 0; x--, p++)
                 *p = col;
         }
     }
@@ -3017,7 +3321,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
 {
     // Sanity Checks
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
-    IM_ASSERT((font_cfg_in->FontData != NULL && font_cfg_in->FontDataSize > 0) || (font_cfg_in->FontLoader != NULL));
+    IM_ASSERT((font_cfg_in->FontData != NULL && font_cfg_in->FontDataSize > 0) || (font_cfg_in->FontSharedData != NULL) || (font_cfg_in->FontLoader != NULL));
     //IM_ASSERT(font_cfg_in->SizePixels > 0.0f && "Is ImFontConfig struct correctly initialized?");
     IM_ASSERT(font_cfg_in->RasterizerDensity > 0.0f && "Is ImFontConfig struct correctly initialized?");
     if (font_cfg_in->GlyphOffset.x != 0.0f || font_cfg_in->GlyphOffset.y != 0.0f || font_cfg_in->GlyphMinAdvanceX != 0.0f || font_cfg_in->GlyphMaxAdvanceX != FLT_MAX)
@@ -3049,6 +3353,14 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     ImFontConfig* font_cfg = &Sources.back();
     if (font_cfg->DstFont == NULL)
         font_cfg->DstFont = font;
+    if (font_cfg->FontSharedData != NULL)
+    {
+        // Shared data is never owned by the atlas: each source holds a reference instead.
+        ImGui::AddRefFontSharedData(font_cfg->FontSharedData);
+        font_cfg->FontData = font_cfg->FontSharedData->Data;
+        font_cfg->FontDataSize = font_cfg->FontSharedData->DataSize;
+        font_cfg->FontDataOwnedByAtlas = false;
+    }
     font->Sources.push_back(font_cfg);
     ImFontAtlasBuildUpdatePointers(this); // Pointers to Sources are otherwise dangling after we called Sources.push_back().
 
@@ -3173,6 +3485,19 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
     return AddFont(&font_cfg);
 }
 
+ImFont* ImFontAtlas::AddFontFromSharedData(ImFontSharedData* shared_data, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
+    IM_ASSERT(shared_data != NULL);
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    IM_ASSERT(font_cfg.FontData == NULL && font_cfg.FontSharedData == NULL);
+    font_cfg.FontSharedData = shared_data;
+    font_cfg.SizePixels = size_pixels > 0.0f ? size_pixels : font_cfg.SizePixels;
+    if (glyph_ranges)
+        font_cfg.GlyphRanges = glyph_ranges;
+    return AddFont(&font_cfg);
+}
+
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
@@ -3623,6 +3948,8 @@ void ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConf
         font->OwnerAtlas = atlas;
         IM_ASSERT(font->Sources[0] == src);
     }
+    font->SourceMapPages.clear(); // Merged sources may provide code-points previously resolved as not found
+    font->SourceMap.clear();
     atlas->TexIsBuilt = false; // For legacy backends
     ImFontAtlasBuildSetupFontSpecialGlyphs(atlas, font, src);
 }
@@ -3635,9 +3962,12 @@ void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
     // - IT WILL THEREFORE CRASH WHEN PASSED DATA WHICH MAY NOT BE FREEED BY IMGUI.
     // - USE `ImFontConfig font_cfg; font_cfg.FontDataOwnedByAtlas = false; io.Fonts->AddFontFromMemoryTTF(....., &cfg);` to disable passing ownership/
     // WE WILL ADDRESS THIS IN A FUTURE REWORK OF THE API.
-    if (src->FontDataOwnedByAtlas)
+    if (src->FontSharedData)
+        ImGui::ReleaseFontSharedData(src->FontSharedData);
+    else if (src->FontDataOwnedByAtlas)
         IM_FREE(src->FontData);
     src->FontData = NULL;
+    src->FontSharedData = NULL;
     if (src->GlyphExcludeRanges)
         IM_FREE((void*)src->GlyphExcludeRanges);
     src->GlyphExcludeRanges = NULL;
@@ -3774,8 +4104,41 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    const int slot = IM_FONTBAKED_INDEX_SLOT(baked, c);
+    baked->IndexLookup[slot] = IM_FONTGLYPH_INDEX_UNUSED;
+    baked->IndexAdvanceX[slot] = baked->FallbackAdvanceX;
+}
+
+// Release pixels of a glyph. It will be loaded again by next call to FindGlyph(). Return number of pixels freed.
+// - Unlike ImFontAtlasBakedDiscardFontGlyph(), AdvanceX is still valid so CalcTextSize() won't need to reload the glyph.
+// - Glyphs[] entry is added to GlyphsFreeList[] for reuse, so glyph pointers are unchanged.
+int ImFontAtlasBakedEvictFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyph)
+{
+    IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
+    IM_ASSERT(glyph->PackId != ImFontAtlasRectId_Invalid);
+    const int glyph_idx = baked->Glyphs.index_from_ptr(glyph);
+    IM_ASSERT(glyph_idx != baked->FallbackGlyphIndex);
+
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int surface = (r->w + pack_padding) * (r->h + pack_padding);
+    baked->MetricsTotalSurface -= ImMin((int)baked->MetricsTotalSurface, r->w * r->h);
+    ImFontAtlasPackDiscardRect(atlas, glyph->PackId);
+    glyph->PackId = ImFontAtlasRectId_Invalid;
+
+    const ImWchar c = (ImWchar)glyph->Codepoint;
+    baked->IndexLookup[IM_FONTBAKED_INDEX_SLOT(baked, c)] = IM_FONTGLYPH_INDEX_UNUSED;
+    baked->GlyphsFreeList.push_back((ImU16)glyph_idx);
+    return surface;
+}
+
+// Approximate memory used by lookup tables and glyphs of a baked font, in bytes.
+int ImFontAtlasBakedGetMemoryUsage(ImFontBaked* baked)
+{
+    int bytes = (int)sizeof(ImFontBaked);
+    bytes += baked->IndexPageMap.Capacity * (int)sizeof(ImU16) + baked->IndexLookup.Capacity * (int)sizeof(ImU16) + baked->IndexAdvanceX.Capacity * (int)sizeof(float);
+    bytes += baked->Glyphs.Capacity * (int)sizeof(ImFontGlyph) + baked->GlyphsFreeList.Capacity * (int)sizeof(ImU16);
+    return bytes;
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
@@ -3897,6 +4260,111 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
     }
 }
 
+static int IMGUI_CDECL ImFontAtlasEvictEntryComparer(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasEvictEntry* a = (const ImFontAtlasEvictEntry*)lhs;
+    const ImFontAtlasEvictEntry* b = (const ImFontAtlasEvictEntry*)rhs;
+    if (a->LastUsedFrame != b->LastUsedFrame)
+        return (a->LastUsedFrame < b->LastUsedFrame) ? -1 : +1;
+    if (a->BakedIdx != b->BakedIdx)
+        return a->BakedIdx - b->BakedIdx;
+    return a->GlyphIdx - b->GlyphIdx;
+}
+
+// Evict least recently used glyphs until 'surface_to_free' pixels are released. Return number of evicted glyphs.
+// - Only glyphs not used for 'unused_frames' frames are considered. Use 1 to preserve everything used during current frame.
+// - Fallback and ellipsis glyphs, and fonts using ImFontFlags_LockBakedSizes (e.g. with custom glyphs) are never evicted.
+int ImFontAtlasBuildEvictGlyphs(ImFontAtlas* atlas, int surface_to_free, int unused_frames)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImVector<ImFontAtlasEvictEntry>& candidates = builder->EvictCandidates;
+    candidates.resize(0);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        ImFont* font = baked->OwnerFont;
+        if (baked->WantDestroy || (font->Flags & ImFontFlags_LockBakedSizes))
+            continue;
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+        {
+            const ImFontGlyph& glyph = baked->Glyphs[glyph_n];
+            if (glyph.PackId == ImFontAtlasRectId_Invalid || glyph.LastUsedFrame + unused_frames > builder->FrameCount)
+                continue;
+            if (glyph_n == baked->FallbackGlyphIndex || glyph.Codepoint == font->EllipsisChar)
+                continue;
+            ImFontAtlasEvictEntry entry = { glyph.LastUsedFrame, baked_n, glyph_n };
+            candidates.push_back(entry);
+        }
+    }
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontAtlasEvictEntry), ImFontAtlasEvictEntryComparer);
+
+    int freed_surface = 0;
+    int evicted_count = 0;
+    for (const ImFontAtlasEvictEntry& entry : candidates)
+    {
+        if (freed_surface >= surface_to_free)
+            break;
+        ImFontBaked* baked = &builder->BakedPool[entry.BakedIdx];
+        freed_surface += ImFontAtlasBakedEvictFontGlyph(atlas, baked, &baked->Glyphs[entry.GlyphIdx]);
+        evicted_count++;
+    }
+    if (evicted_count > 0)
+        IMGUI_DEBUG_LOG_FONT("[font] Evicted %d glyphs, %d px\n", evicted_count, freed_surface);
+    builder->GlyphsEvictedCount += evicted_count;
+    return evicted_count;
+}
+
+// Resident memory for atlas->MemoryBudget: all current textures, plus lookup tables and glyphs of baked fonts.
+int ImFontAtlasBuildGetResidentBytes(ImFontAtlas* atlas, int* out_tex_bytes, int* out_baked_bytes)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int tex_bytes = 0;
+    int baked_bytes = 0;
+    if (builder != NULL)
+    {
+        for (int page_n = 0; page_n < builder->Pages.Size; page_n++)
+            if (ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, page_n))
+                tex_bytes += tex->Width * tex->Height * tex->BytesPerPixel;
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+            if (!builder->BakedPool[baked_n].WantDestroy)
+                baked_bytes += ImFontAtlasBakedGetMemoryUsage(&builder->BakedPool[baked_n]);
+    }
+    if (out_tex_bytes)
+        *out_tex_bytes = tex_bytes;
+    if (out_baked_bytes)
+        *out_baked_bytes = baked_bytes;
+    return tex_bytes + baked_bytes;
+}
+
+// Called once per frame. When over budget (e.g. budget was lowered):
+// - Discard baked fonts unused for a few frames, releasing their tables.
+// - Evict least recently used glyphs then shrink the texture if it would be smaller.
+void ImFontAtlasBuildUpdateMemoryBudget(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (atlas->MemoryBudget <= 0 || ImFontAtlasBuildGetResidentBytes(atlas) <= atlas->MemoryBudget)
+        return;
+
+    const int baked_discarded_count = builder->BakedDiscardedCount;
+    ImFontAtlasBuildDiscardBakes(atlas, 2);
+    builder->BakedEvictedCount += builder->BakedDiscardedCount - baked_discarded_count;
+
+    const int resident_bytes = ImFontAtlasBuildGetResidentBytes(atlas);
+    if (resident_bytes <= atlas->MemoryBudget)
+        return;
+    ImTextureData* tex = atlas->TexData;
+    if (ImFontAtlasBuildEvictGlyphs(atlas, (resident_bytes - atlas->MemoryBudget) / tex->BytesPerPixel, 2) == 0 && builder->BakedDiscardedCount == baked_discarded_count)
+        return;
+
+    // Shrink texture, only if that's enough to fit in budget (otherwise we would likely grow it again soon)
+    ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
+    if (ImFontAtlasTextureUsePages(atlas))
+        new_tex_size = ImVec2i(ImMax(new_tex_size.x, atlas->TexPageWidth), ImMax(new_tex_size.y, atlas->TexPageHeight));
+    const int new_tex_bytes = new_tex_size.x * new_tex_size.y * tex->BytesPerPixel;
+    if (new_tex_size.x * new_tex_size.y < tex->Width * tex->Height && ImFontAtlasBuildGetResidentBytes(atlas) - tex->Width * tex->Height * tex->BytesPerPixel + new_tex_bytes <= atlas->MemoryBudget)
+        ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
+}
+
 // Those functions are designed to facilitate changing the underlying structures for ImFontAtlas to store an array of ImDrawListSharedData*
 void ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
@@ -3913,6 +4381,10 @@ void ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedDat
 // Update texture identifier in all active draw lists
 void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex)
 {
+    // A thread-shared atlas is only modified while no context is within a frame (and we can't read other contexts' state).
+    if (atlas->Flags & ImFontAtlasFlags_ThreadShared)
+        return;
+
     for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
     {
         // If Context 2 uses font owned by Context 1 which already called EndFrame()/Render(), we don't want to mess with draw commands for Context 1
@@ -3996,6 +4468,39 @@ ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
     return new_tex;
 }
 
+// Texture pages are only used when a fixed page size is specified and the backend supports ImGuiBackendFlags_RendererHasTextures.
+bool ImFontAtlasTextureUsePages(ImFontAtlas* atlas)
+{
+    return atlas->TexPageWidth > 0 && atlas->TexPageHeight > 0 && atlas->RendererHasTextures;
+}
+
+// Add a new texture page of TexPageWidth x TexPageHeight. Return -1 if we ran out of pages.
+// Unlike ImFontAtlasTextureAdd(), this doesn't replace atlas->TexData: existing pages are never resized or repacked.
+// Pages normally use the same format as atlas->TexData, but an Alpha8 atlas may add RGBA32 pages to store colored glyphs.
+int ImFontAtlasTextureAddPage(ImFontAtlas* atlas, ImTextureFormat format)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->Pages.Size >= IM_FONTATLAS_MAX_PAGES)
+        return -1;
+    IM_ASSERT(ImIsPowerOfTwo(atlas->TexPageWidth) && ImIsPowerOfTwo(atlas->TexPageHeight));
+    IM_ASSERT(atlas->TexPageWidth <= 0xFFFF && atlas->TexPageHeight <= 0xFFFF);
+
+    ImTextureData* new_tex = IM_NEW(ImTextureData)();
+    new_tex->UniqueID = atlas->TexNextUniqueID++;
+    new_tex->Create(format, atlas->TexPageWidth, atlas->TexPageHeight);
+    if (format == atlas->TexData->Format)
+        new_tex->UseColors = atlas->TexData->UseColors;
+    atlas->TexList.push_back(new_tex);
+
+    builder->Pages.push_back(ImFontAtlasPage());
+    ImFontAtlasPage* page = &builder->Pages.back();
+    page->TexData = new_tex;
+    ImTextureRect free_r = { 0, 0, (unsigned short)new_tex->Width, (unsigned short)new_tex->Height };
+    page->PackFreeRects.push_back(free_r);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: add page %d, %dx%d\n", new_tex->UniqueID, builder->Pages.Size - 1, new_tex->Width, new_tex->Height);
+    return builder->Pages.Size - 1;
+}
+
 #if 0
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "../stb/stb_image_write.h"
@@ -4008,6 +4513,37 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 }
 #endif
 
+static void ImFontAtlasBuildUpdateGlyphUV(ImFontAtlas* atlas, ImFontGlyph* glyph, const ImTextureRect* r)
+{
+    ImVec2 uv_scale = atlas->TexUvScale;
+    if (glyph->PageIdx != 0)
+    {
+        ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, glyph->PageIdx);
+        uv_scale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+    }
+    glyph->U0 = (r->x) * uv_scale.x;
+    glyph->V0 = (r->y) * uv_scale.y;
+    glyph->U1 = (r->x + r->w) * uv_scale.x;
+    glyph->V1 = (r->y + r->h) * uv_scale.y;
+}
+
+struct ImFontAtlasPackSortEntry
+{
+    unsigned short  W, H;
+    int             IndexIdx;
+};
+
+static int IMGUI_CDECL ImFontAtlasPackSortEntryComparer(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasPackSortEntry* a = (const ImFontAtlasPackSortEntry*)lhs;
+    const ImFontAtlasPackSortEntry* b = (const ImFontAtlasPackSortEntry*)rhs;
+    if (int d = (int)b->H - (int)a->H)
+        return d;
+    if (int d = (int)b->W - (int)a->W)
+        return d;
+    return a->IndexIdx - b->IndexIdx;
+}
+
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
@@ -4023,21 +4559,47 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     //ImFontAtlasDebugWriteTexToDisk(old_tex, "Before Pack");
 
     // Repack, lose discarded rectangle, copy pixels
-    // FIXME-NEWATLAS: This is unstable because packing order is based on RectsIndex
-    // FIXME-NEWATLAS-V2: Repacking in batch would be beneficial to packing heuristic, and fix stability.
+    // - Rectangles are sorted by decreasing height then width, which is beneficial to packing heuristic and makes output stable.
     // FIXME-NEWATLAS-TESTS: Test calling RepackTexture with size too small to fits existing rects.
     ImFontAtlasPackInit(atlas);
+    builder->RepackCount++;
+    for (ImFontAtlasPage& page : builder->Pages)
+        page.RectsPackedSurface = page.RectsDiscardedSurface = 0; // Discarded rectangles are dropped below, in every page
     ImVector<ImTextureRect> old_rects;
+    ImVector<ImU8> old_rects_page_idx;
     ImVector<ImFontAtlasRectEntry> old_index = builder->RectsIndex;
     old_rects.swap(builder->Rects);
+    old_rects_page_idx.swap(builder->RectsPageIdx);
 
+    ImVector<ImFontAtlasPackSortEntry> sorted_entries;
+    sorted_entries.reserve(builder->RectsIndex.Size);
     for (ImFontAtlasRectEntry& index_entry : builder->RectsIndex)
+        if (index_entry.IsUsed)
+        {
+            ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
+            if (old_r.w == 0 && old_r.h == 0)
+                continue;
+            ImFontAtlasPackSortEntry sort_entry = { old_r.w, old_r.h, builder->RectsIndex.index_from_ptr(&index_entry) };
+            sorted_entries.push_back(sort_entry);
+        }
+    ImQsort(sorted_entries.Data, (size_t)sorted_entries.Size, sizeof(ImFontAtlasPackSortEntry), ImFontAtlasPackSortEntryComparer);
+
+    for (const ImFontAtlasPackSortEntry& sort_entry : sorted_entries)
     {
-        if (index_entry.IsUsed == false)
-            continue;
+        ImFontAtlasRectEntry& index_entry = builder->RectsIndex[sort_entry.IndexIdx];
         ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
-        if (old_r.w == 0 && old_r.h == 0)
+        if (const int page_idx = old_rects_page_idx[index_entry.TargetIndex])
+        {
+            // Rectangles stored in other texture pages are left untouched
+            builder->Rects.push_back(old_r);
+            builder->RectsPageIdx.push_back((ImU8)page_idx);
+            const int surface = (old_r.w + atlas->TexGlyphPadding) * (old_r.h + atlas->TexGlyphPadding);
+            builder->RectsPackedCount++;
+            builder->RectsPackedSurface += surface;
+            builder->Pages[page_idx].RectsPackedSurface += surface;
+            index_entry.TargetIndex = builder->Rects.Size - 1;
             continue;
+        }
         ImFontAtlasRectId new_r_id = ImFontAtlasPackAddRect(atlas, old_r.w, old_r.h, &index_entry);
         if (new_r_id == ImFontAtlasRectId_Invalid)
         {
@@ -4046,6 +4608,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
             IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize failed. Will grow.\n", new_tex->UniqueID);
             new_tex->WantDestroyNextFrame = true;
             builder->Rects.swap(old_rects);
+            builder->RectsPageIdx.swap(old_rects_page_idx);
             builder->RectsIndex = old_index;
             ImFontAtlasBuildSetTexture(atlas, old_tex);
             ImFontAtlasTextureGrow(atlas, w, h); // Recurse
@@ -4063,13 +4626,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
             if (glyph.PackId != ImFontAtlasRectId_Invalid)
-            {
-                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
-                glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
-                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
-            }
+                ImFontAtlasBuildUpdateGlyphUV(atlas, &glyph, ImFontAtlasPackGetRect(atlas, glyph.PackId));
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4117,13 +4674,27 @@ void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
     // Can some baked contents be ditched?
     //IMGUI_DEBUG_LOG_FONT("[font] ImFontAtlasBuildMakeSpace()\n");
     ImFontAtlasBuilder* builder = atlas->Builder;
+    const int discarded_count = builder->RectsDiscardedCount;
     ImFontAtlasBuildDiscardBakes(atlas, 2);
+    if (builder->RectsDiscardedCount > discarded_count)
+        return; // Discarded space is immediately reusable, caller will try packing again.
 
     // Currently using a heuristic for repack without growing.
-    if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
+    // Discarded space is already reused by the packer, so we only repack when free space exists but is too fragmented to be used.
+    ImTextureData* tex = atlas->TexData;
+    const int free_surface = tex->Width * tex->Height - builder->Pages[0].GetUsedSurface(); // Only first page is grown or repacked
+    const bool want_grow = (builder->RectsDiscardedCount == 0 || free_surface < tex->Width * tex->Height * 0.20f);
+
+    // Stay within memory budget: evict least recently used glyphs instead of growing (growing doubles texture size).
+    // If evicted space is too fragmented to be used, next call will repack.
+    if (want_grow && atlas->MemoryBudget > 0 && ImFontAtlasBuildGetResidentBytes(atlas) + tex->Width * tex->Height * tex->BytesPerPixel > atlas->MemoryBudget)
+        if (ImFontAtlasBuildEvictGlyphs(atlas, tex->Width * tex->Height / 4, 1) > 0)
+            return;
+
+    if (want_grow)
         ImFontAtlasTextureGrow(atlas);
     else
-        ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+        ImFontAtlasTextureRepack(atlas, tex->Width, tex->Height);
 }
 
 ImVec2i ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas)
@@ -4136,7 +4707,7 @@ ImVec2i ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas)
     ImFontAtlasBuilder* builder = atlas->Builder;
     min_w = ImMax(ImUpperPowerOfTwo(builder->MaxRectSize.x), min_w);
     min_h = ImMax(ImUpperPowerOfTwo(builder->MaxRectSize.y), min_h);
-    const int surface_approx = builder->RectsPackedSurface - builder->RectsDiscardedSurface; // Expected surface after repack
+    const int surface_approx = builder->Pages[0].GetUsedSurface(); // Expected surface after repack. Only the first page is resized, other pages are left untouched.
     const int surface_sqrt = (int)sqrtf((float)surface_approx);
 
     int new_tex_w;
@@ -4244,6 +4815,13 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->Builder)
+        for (int page_n = 0; page_n < atlas->Builder->Pages.Size; page_n++)
+        {
+            if (page_n > 0)
+                atlas->Builder->Pages[page_n].TexData->WantDestroyNextFrame = true;
+            atlas->Builder->Pages[page_n].PackFreeRects.clear(); // ImVector<> doesn't destruct its elements
+        }
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
@@ -4253,16 +4831,178 @@ void ImFontAtlasPackInit(ImFontAtlas * atlas)
     ImTextureData* tex = atlas->TexData;
     ImFontAtlasBuilder* builder = atlas->Builder;
 
-    // In theory we could decide to reduce the number of nodes, e.g. halve them, and waste a little texture space, but it doesn't seem worth it.
-    const int pack_node_count = tex->Width / 2;
-    builder->PackNodes.resize(pack_node_count);
-    IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
-    stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
+    // Whole texture is a single free rectangle
+    IM_ASSERT(tex->Width <= 0xFFFF && tex->Height <= 0xFFFF);
+    ImTextureRect free_r = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+    if (builder->Pages.Size == 0)
+        builder->Pages.push_back(ImFontAtlasPage());
+    builder->Pages[0].PackFreeRects.resize(0);
+    builder->Pages[0].PackFreeRects.push_back(free_r);
+    builder->Pages[0].PackFreeRectsDirty = false;
+    builder->Pages[0].RectsPackedSurface = builder->Pages[0].RectsDiscardedSurface = 0;
     builder->RectsPackedSurface = builder->RectsPackedCount = 0;
     builder->MaxRectSize = ImVec2i(0, 0);
     builder->MaxRectBounds = ImVec2i(0, 0);
 }
 
+static inline bool ImTextureRectContains(const ImTextureRect& a, const ImTextureRect& b)
+{
+    return b.x >= a.x && b.y >= a.y && b.x + b.w <= a.x + a.w && b.y + b.h <= a.y + a.h;
+}
+
+static inline bool ImTextureRectOverlaps(const ImTextureRect& a, const ImTextureRect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+// Find best free rectangle for a w*h (padded) rectangle, using Best Short Side Fit heuristic.
+// Ties are broken toward the top of the texture, which keeps used space compact and helps ImFontAtlasTextureGetSizeEstimate().
+static bool ImFontAtlasPackFindPosition(ImFontAtlasPage* page, int w, int h, int* out_x, int* out_y)
+{
+    int best_short_side = INT_MAX, best_long_side = INT_MAX, best_y = INT_MAX;
+    for (const ImTextureRect& free_r : page->PackFreeRects)
+    {
+        if (free_r.w < w || free_r.h < h)
+            continue;
+        const int leftover_x = free_r.w - w;
+        const int leftover_y = free_r.h - h;
+        const int short_side = ImMin(leftover_x, leftover_y);
+        const int long_side = ImMax(leftover_x, leftover_y);
+        if (short_side < best_short_side || (short_side == best_short_side && (long_side < best_long_side || (long_side == best_long_side && free_r.y < best_y))))
+        {
+            *out_x = free_r.x;
+            *out_y = best_y = free_r.y;
+            best_short_side = short_side;
+            best_long_side = long_side;
+        }
+    }
+    return best_short_side != INT_MAX;
+}
+
+// Add candidate free rectangles from PackFreeRectsNew[] to PackFreeRects[], discarding the ones contained in another.
+// Existing free rectangles contained in a new one are removed as well.
+static void ImFontAtlasPackCommitNewFreeRects(ImFontAtlasBuilder* builder, ImFontAtlasPage* page)
+{
+    ImVector<ImTextureRect>& free_rects = page->PackFreeRects;
+    ImVector<ImTextureRect>& new_rects = builder->PackFreeRectsNew;
+    for (int new_n = 0; new_n < new_rects.Size; new_n++)
+    {
+        const ImTextureRect new_r = new_rects[new_n];
+        bool redundant = false;
+        for (int other_n = 0; other_n < new_rects.Size && !redundant; other_n++)
+            if (other_n != new_n && ImTextureRectContains(new_rects[other_n], new_r))
+                redundant = (new_rects[other_n].w != new_r.w || new_rects[other_n].h != new_r.h || other_n < new_n); // Keep first of duplicates
+        for (int free_n = 0; free_n < free_rects.Size && !redundant; free_n++)
+            redundant = ImTextureRectContains(free_rects[free_n], new_r);
+        if (redundant)
+        {
+            new_rects.erase_unsorted(&new_rects[new_n--]);
+            continue;
+        }
+        for (int free_n = 0; free_n < free_rects.Size; free_n++)
+            if (ImTextureRectContains(new_r, free_rects[free_n]))
+                free_rects.erase_unsorted(&free_rects[free_n--]);
+    }
+    for (const ImTextureRect& new_r : new_rects)
+        free_rects.push_back(new_r);
+    new_rects.resize(0);
+}
+
+// Carve used rectangle out of all free rectangles it overlaps with, leaving up to 4 maximal free rectangles for each.
+static void ImFontAtlasPackPlaceRect(ImFontAtlasBuilder* builder, ImFontAtlasPage* page, const ImTextureRect& used_r)
+{
+    ImVector<ImTextureRect>& free_rects = page->PackFreeRects;
+    ImVector<ImTextureRect>& new_rects = builder->PackFreeRectsNew;
+    IM_ASSERT(new_rects.Size == 0);
+    for (int free_n = 0; free_n < free_rects.Size; free_n++)
+    {
+        const ImTextureRect free_r = free_rects[free_n];
+        if (!ImTextureRectOverlaps(free_r, used_r))
+            continue;
+        if (used_r.x > free_r.x) // Left
+            new_rects.push_back({ free_r.x, free_r.y, (unsigned short)(used_r.x - free_r.x), free_r.h });
+        if (used_r.x + used_r.w < free_r.x + free_r.w) // Right
+            new_rects.push_back({ (unsigned short)(used_r.x + used_r.w), free_r.y, (unsigned short)(free_r.x + free_r.w - (used_r.x + used_r.w)), free_r.h });
+        if (used_r.y > free_r.y) // Top
+            new_rects.push_back({ free_r.x, free_r.y, free_r.w, (unsigned short)(used_r.y - free_r.y) });
+        if (used_r.y + used_r.h < free_r.y + free_r.h) // Bottom
+            new_rects.push_back({ free_r.x, (unsigned short)(used_r.y + used_r.h), free_r.w, (unsigned short)(free_r.y + free_r.h - (used_r.y + used_r.h)) });
+        free_rects.erase_unsorted(&free_rects[free_n--]);
+    }
+    ImFontAtlasPackCommitNewFreeRects(builder, page);
+}
+
+// Return a previously used rectangle to the free list.
+// We grow it by merging with free rectangles sharing a full edge, which is cheap and catches the common case
+// of neighbor glyphs being discarded together. Remaining fragmentation is handled by ImFontAtlasPackDefragStep().
+static void ImFontAtlasPackFreeRect(ImFontAtlasBuilder* builder, ImFontAtlasPage* page, ImTextureRect freed_r)
+{
+    ImVector<ImTextureRect>& free_rects = page->PackFreeRects;
+    for (bool merged = true; merged; )
+    {
+        merged = false;
+        for (const ImTextureRect& free_r : free_rects)
+        {
+            if (free_r.x == freed_r.x && free_r.w == freed_r.w && (free_r.y + free_r.h == freed_r.y || freed_r.y + freed_r.h == free_r.y))
+            {
+                freed_r.h = (unsigned short)(freed_r.h + free_r.h);
+                freed_r.y = ImMin(freed_r.y, free_r.y);
+                merged = true;
+            }
+            else if (free_r.y == freed_r.y && free_r.h == freed_r.h && (free_r.x + free_r.w == freed_r.x || freed_r.x + freed_r.w == free_r.x))
+            {
+                freed_r.w = (unsigned short)(freed_r.w + free_r.w);
+                freed_r.x = ImMin(freed_r.x, free_r.x);
+                merged = true;
+            }
+            if (merged)
+            {
+                free_rects.erase_unsorted(&free_r);
+                break;
+            }
+        }
+    }
+    builder->PackFreeRectsNew.push_back(freed_r);
+    ImFontAtlasPackCommitNewFreeRects(builder, page);
+    page->PackFreeRectsDirty = true;
+}
+
+// Freed rectangles are only merged with neighbors of identical size, so after many discards free space may be
+// scattered into small pieces. Rebuild maximal free rectangles of a page from its used rectangles.
+static void ImFontAtlasPackRebuildFreeRects(ImFontAtlas* atlas, int page_idx)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasPage* page = &builder->Pages[page_idx];
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, page_idx);
+    ImTextureRect full_r = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+    page->PackFreeRects.resize(0);
+    page->PackFreeRects.push_back(full_r);
+    const int pack_padding = atlas->TexGlyphPadding;
+    for (int rect_n = 0; rect_n < builder->Rects.Size; rect_n++)
+    {
+        const ImTextureRect& r = builder->Rects[rect_n];
+        if (builder->RectsPageIdx[rect_n] != page_idx || (r.w == 0 && r.h == 0)) // Skip discarded rectangles
+            continue;
+        ImTextureRect used_r = { r.x, r.y, (unsigned short)(r.w + pack_padding), (unsigned short)(r.h + pack_padding) };
+        ImFontAtlasPackPlaceRect(builder, page, used_r);
+    }
+    page->PackFreeRectsDirty = false;
+}
+
+// Clear pixels so a rectangle reusing this space won't have stale data in its padding, then return space to the free list.
+static void ImFontAtlasPackReleaseSpace(ImFontAtlas* atlas, int page_idx, const ImTextureRect* r)
+{
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, page_idx);
+    if (tex != NULL && tex->Pixels != NULL && tex->Status != ImTextureStatus_WantDestroy && tex->Status != ImTextureStatus_Destroyed)
+    {
+        ImFontAtlasTextureBlockFill(tex, r->x, r->y, r->w, r->h, IM_COL32_BLACK_TRANS);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
+    }
+    const int pack_padding = atlas->TexGlyphPadding;
+    ImTextureRect freed_r = { r->x, r->y, (unsigned short)(r->w + pack_padding), (unsigned short)(r->h + pack_padding) };
+    ImFontAtlasPackFreeRect(atlas->Builder, &atlas->Builder->Pages[page_idx], freed_r);
+}
+
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
 static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int rect_idx)
 {
@@ -4297,7 +5037,7 @@ static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFon
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// Space is returned to the free list and may be reused immediately by ImFontAtlasPackAddRect().
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4310,6 +5050,7 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     int index_idx = ImFontAtlasRectId_GetIndex(id);
     ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
     IM_ASSERT(index_entry->IsUsed && index_entry->TargetIndex >= 0);
+    const int page_idx = builder->RectsPageIdx[index_entry->TargetIndex];
     index_entry->IsUsed = false;
     index_entry->TargetIndex = builder->RectsIndexFreeListStart;
     index_entry->Generation++;
@@ -4320,12 +5061,21 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
     builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    builder->Pages[page_idx].RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+
+    builder->DefragIdle = false;
+    ImFontAtlasPackReleaseSpace(atlas, page_idx, rect);
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
 // Important: Calling this may recreate a new texture and therefore change atlas->TexData
+// - When 'allow_any_page' is set and texture pages are enabled, rectangle may be packed in any page (see ImFontAtlasPackGetRectPageIdx()),
+//   and a new page will be added instead of growing the texture. This is used for glyphs, which store their page index.
+//   Other rectangles are always packed in page 0, as users of e.g. GetCustomRect() only know about atlas->TexRef.
+// - When 'want_colors' is set and texture pages are enabled on an Alpha8 atlas, rectangle is packed in a RGBA32 page so colored glyphs
+//   (e.g. emojis) keep their colors while the rest of the atlas stays at 1 byte per pixel. Other rectangles are never packed in those pages.
 // FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
-ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry, bool allow_any_page, bool want_colors)
 {
     IM_ASSERT(w > 0 && w <= 0xFFFF);
     IM_ASSERT(h > 0 && h <= 0xFFFF);
@@ -4336,18 +5086,41 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     builder->MaxRectSize.y = ImMax(builder->MaxRectSize.y, h);
 
     // Pack
+    const bool use_pages = allow_any_page && ImFontAtlasTextureUsePages(atlas);
+    ImTextureFormat page_format = (use_pages && want_colors) ? ImTextureFormat_RGBA32 : atlas->TexData->Format;
     ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
+    int page_idx = 0;
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
-        // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
+        // Try packing (into first page with space and matching format)
+        int pack_x = 0, pack_y = 0;
+        page_idx = -1;
+        for (int n = 0; n < (use_pages ? builder->Pages.Size : 1) && page_idx == -1; n++)
+            if (!use_pages || ImFontAtlasPackGetPageTexture(atlas, n)->Format == page_format)
+                if (ImFontAtlasPackFindPosition(&builder->Pages[n], w + pack_padding, h + pack_padding, &pack_x, &pack_y))
+                    page_idx = n;
+        if (page_idx != -1)
+        {
+            r.x = (unsigned short)pack_x;
+            r.y = (unsigned short)pack_y;
+            ImTextureRect used_r = { r.x, r.y, (unsigned short)(w + pack_padding), (unsigned short)(h + pack_padding) };
+            ImFontAtlasPackPlaceRect(builder, &builder->Pages[page_idx], used_r);
             break;
+        }
+
+        // Rebuild scattered free rectangles and try again
+        bool rebuilt_free_rects = false;
+        for (int n = 0; n < (use_pages ? builder->Pages.Size : 1); n++)
+            if (builder->Pages[n].PackFreeRectsDirty)
+            {
+                ImFontAtlasPackRebuildFreeRects(atlas, n);
+                rebuilt_free_rects = true;
+            }
+        if (rebuilt_free_rects)
+        {
+            attempts_remaining++;
+            continue;
+        }
 
         // If we ran out of attempts, return fallback
         if (attempts_remaining == 0 || builder->LockDisableResize)
@@ -4357,15 +5130,43 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
         }
 
         // Resize or repack atlas! (this should be a rare event)
-        ImFontAtlasTextureMakeSpace(atlas);
+        // With texture pages, existing textures are never resized: discard unused bakes or add a new page.
+        if (use_pages)
+        {
+            const int discarded_count = builder->RectsDiscardedCount;
+            ImFontAtlasBuildDiscardBakes(atlas, 2);
+            if (builder->RectsDiscardedCount > discarded_count)
+                continue;
+            const int page_bytes = atlas->TexPageWidth * atlas->TexPageHeight * ImTextureDataGetFormatBytesPerPixel(page_format);
+            if (page_format == atlas->TexData->Format && (atlas->TexData->Width < atlas->TexPageWidth || atlas->TexData->Height < atlas->TexPageHeight))
+                ImFontAtlasTextureGrow(atlas); // First page grows normally until it reaches page size
+            else if (atlas->MemoryBudget > 0 && ImFontAtlasBuildGetResidentBytes(atlas) + page_bytes > atlas->MemoryBudget && ImFontAtlasBuildEvictGlyphs(atlas, atlas->TexPageWidth * atlas->TexPageHeight / 4, 1) > 0)
+                attempts_remaining++; // Stay within memory budget: evict least recently used glyphs instead of adding a page, until nothing can be evicted
+            else if (ImFontAtlasTextureAddPage(atlas, page_format) == -1)
+            {
+                if (page_format != atlas->TexData->Format)
+                    page_format = atlas->TexData->Format; // Out of pages: store colored rectangle in a regular page (colors are lost)
+                else
+                    ImFontAtlasTextureMakeSpace(atlas); // Out of pages: grow first page beyond page size
+            }
+        }
+        else
+        {
+            ImFontAtlasTextureMakeSpace(atlas);
+        }
     }
 
-    builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
-    builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
+    if (page_idx == 0)
+    {
+        builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
+        builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
+    }
     builder->RectsPackedCount++;
     builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    builder->Pages[page_idx].RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
 
     builder->Rects.push_back(r);
+    builder->RectsPageIdx.push_back((ImU8)page_idx);
     if (overwrite_entry != NULL)
         return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
     else
@@ -4403,6 +5204,128 @@ ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId
     return &builder->Rects[index_entry->TargetIndex];
 }
 
+int ImFontAtlasPackGetRectPageIdx(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
+    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id) && index_entry->IsUsed);
+    return builder->RectsPageIdx[index_entry->TargetIndex];
+}
+
+ImTextureData* ImFontAtlasPackGetPageTexture(ImFontAtlas* atlas, int page_idx)
+{
+    return (page_idx == 0) ? atlas->TexData : atlas->Builder->Pages[page_idx].TexData;
+}
+
+ImTextureRef ImFontAtlasPackGetPageTexRef(ImFontAtlas* atlas, int page_idx)
+{
+    if (page_idx == 0)
+        return atlas->TexRef;
+    ImTextureRef tex_ref;
+    tex_ref._TexData = atlas->Builder->Pages[page_idx].TexData;
+    return tex_ref;
+}
+
+// Fragmentation is 0.0f when all free space is available as a single rectangle, and tends toward 1.0f as free space gets scattered.
+float ImFontAtlasPackGetFragmentation(ImFontAtlas* atlas, int* out_free_surface, int* out_largest_free_surface)
+{
+    // Free space of a page can only be used by a rectangle packed into that page: sum largest free rectangle of each page.
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int free_surface = 0;
+    int largest_free_surface = 0;
+    int largest_free_surface_sum = 0;
+    for (int page_n = 0; page_n < builder->Pages.Size; page_n++)
+    {
+        ImFontAtlasPage* page = &builder->Pages[page_n];
+        ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, page_n);
+        int page_largest_free_surface = 0;
+        for (const ImTextureRect& free_r : page->PackFreeRects)
+            page_largest_free_surface = ImMax(page_largest_free_surface, free_r.w * free_r.h);
+        free_surface += ImMax(tex->Width * tex->Height - page->GetUsedSurface(), page_largest_free_surface);
+        largest_free_surface = ImMax(largest_free_surface, page_largest_free_surface);
+        largest_free_surface_sum += page_largest_free_surface;
+    }
+    if (out_free_surface)
+        *out_free_surface = free_surface;
+    if (out_largest_free_surface)
+        *out_largest_free_surface = largest_free_surface;
+    return (free_surface > 0) ? 1.0f - (float)largest_free_surface_sum / (float)free_surface : 0.0f;
+}
+
+static int IMGUI_CDECL ImFontAtlasDefragCandidateComparer(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasDefragCandidate* a = (const ImFontAtlasDefragCandidate*)lhs;
+    const ImFontAtlasDefragCandidate* b = (const ImFontAtlasDefragCandidate*)rhs;
+    return b->Bottom - a->Bottom;
+}
+
+// Incremental defragmentation: move bottom-most glyphs into free space higher in the texture, copying at most 'pixel_budget' pixels.
+// This coalesces free space at the bottom of the texture, so we can avoid a full repack (which re-creates and re-uploads the whole texture).
+// - Only glyphs are moved: other rectangles (white pixel, lines, custom rects) may have UV cached by their owner.
+// - Called from ImFontAtlasUpdateNewFrame() before any draw command for the frame is emitted. Returns number of pixels copied.
+int ImFontAtlasPackDefragStep(ImFontAtlas* atlas, int pixel_budget)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (pixel_budget <= 0 || builder->DefragIdle || builder->LockDisableResize)
+        return 0;
+    if (ImFontAtlasPackGetFragmentation(atlas) < builder->DefragThreshold)
+        return 0;
+
+    // Gather glyphs, bottom-most first
+    ImVector<ImFontAtlasDefragCandidate>& candidates = builder->DefragCandidates;
+    candidates.resize(0);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        for (ImFontGlyph& glyph : baked->Glyphs)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid)
+            {
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+                ImFontAtlasDefragCandidate candidate = { &glyph, r->y + r->h };
+                candidates.push_back(candidate);
+            }
+    }
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontAtlasDefragCandidate), ImFontAtlasDefragCandidateComparer);
+
+    // Move glyphs up
+    const int pack_padding = atlas->TexGlyphPadding;
+    int moved_surface = 0;
+    for (const ImFontAtlasDefragCandidate& candidate : candidates)
+    {
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, candidate.Glyph->PackId);
+        if (moved_surface + r->w * r->h > pixel_budget)
+            break;
+        const int page_idx = candidate.Glyph->PageIdx;
+        ImFontAtlasPage* page = &builder->Pages[page_idx];
+        ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, page_idx);
+        if (tex->Pixels == NULL || tex->Status == ImTextureStatus_WantDestroy || tex->Status == ImTextureStatus_Destroyed)
+            continue;
+        int new_x, new_y;
+        if (!ImFontAtlasPackFindPosition(page, r->w + pack_padding, r->h + pack_padding, &new_x, &new_y) || new_y >= r->y)
+            continue;
+        ImTextureRect used_r = { (unsigned short)new_x, (unsigned short)new_y, (unsigned short)(r->w + pack_padding), (unsigned short)(r->h + pack_padding) };
+        ImFontAtlasPackPlaceRect(builder, page, used_r);
+        ImFontAtlasTextureBlockCopy(tex, r->x, r->y, tex, new_x, new_y, r->w, r->h);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, new_x, new_y, r->w, r->h);
+        ImTextureRect old_r = *r;
+        r->x = (unsigned short)new_x;
+        r->y = (unsigned short)new_y;
+        ImFontAtlasBuildUpdateGlyphUV(atlas, candidate.Glyph, r);
+        ImFontAtlasPackReleaseSpace(atlas, page_idx, &old_r);
+        if (page_idx == 0)
+            builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, new_x + r->w + pack_padding);
+        builder->DefragMovedCount++;
+        moved_surface += r->w * r->h;
+    }
+    builder->DefragMovedSurface += moved_surface;
+    if (moved_surface == 0)
+        builder->DefragIdle = true; // Nothing can be moved until something is discarded
+    return moved_surface;
+}
+
 // Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
 // Use "Input Glyphs Overlap Detection Tool" to display a list of glyphs provided by multiple sources in order to set this array up.
 static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
@@ -4414,13 +5337,71 @@ static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar
     return true;
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
+static int ImFontAtlasFontProbeSources(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+    {
+        ImFontConfig* src = font->Sources[src_n];
+        if (src->GlyphExcludeRanges && !ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            continue;
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontSrcContainsGlyph == NULL || loader->FontSrcContainsGlyph(atlas, src, codepoint)) // Loaders without a query are always tried
+            return src_n;
+    }
+    return -1;
+}
+
+// Resolve which source provides a code-point. Sources are probed once per code-point, result is shared by all baked sizes.
+// - Many merged sources (icons, CJK, emoji...) would otherwise make every glyph miss probe each source cmap in order.
+// - The map is cleared when a source is added or the font loader changes.
+int ImFontAtlasFontResolveSource(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    if (font->Sources.Size > IM_FONTSOURCE_MAP_MAX_SOURCES)
+        return ImFontAtlasFontProbeSources(atlas, font, codepoint);
+
+    const int page_n = (int)codepoint >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    if (page_n < font->SourceMapPages.Size)
+    {
+        ImU8 v = font->SourceMap.Data[((int)font->SourceMapPages.Data[page_n] << IM_FONTBAKED_INDEX_PAGE_SHIFT) + (codepoint & IM_FONTBAKED_INDEX_PAGE_MASK)];
+        if (v != IM_FONTSOURCE_MAP_UNRESOLVED)
+            return (v == IM_FONTSOURCE_MAP_NOT_FOUND) ? -1 : v - 1;
+    }
+
+    // Allocate page (page 0 is a shared unresolved page which is never written to)
+    if (page_n >= font->SourceMapPages.Size)
+        font->SourceMapPages.resize(page_n + 1, 0);
+    if (font->SourceMapPages.Data[page_n] == 0)
+    {
+        if (font->SourceMap.Size == 0)
+            font->SourceMap.resize(IM_FONTBAKED_INDEX_PAGE_SIZE, IM_FONTSOURCE_MAP_UNRESOLVED);
+        font->SourceMapPages.Data[page_n] = (ImU16)(font->SourceMap.Size >> IM_FONTBAKED_INDEX_PAGE_SHIFT);
+        font->SourceMap.resize(font->SourceMap.Size + IM_FONTBAKED_INDEX_PAGE_SIZE, IM_FONTSOURCE_MAP_UNRESOLVED);
+    }
+    const int src_n = ImFontAtlasFontProbeSources(atlas, font, codepoint);
+    font->SourceMap.Data[((int)font->SourceMapPages.Data[page_n] << IM_FONTBAKED_INDEX_PAGE_SHIFT) + (codepoint & IM_FONTBAKED_INDEX_PAGE_MASK)] = (src_n == -1) ? (ImU8)IM_FONTSOURCE_MAP_NOT_FOUND : (ImU8)(src_n + 1);
+    return src_n;
+}
+
+// Return index into IndexLookup[]/IndexAdvanceX[] for writing, allocating a page if needed.
+// - Page 0 is shared by all code-points of unallocated pages and must never be written to.
+static int ImFontBaked_BuildGetIndexSlot(ImFontBaked* baked, ImWchar codepoint)
 {
     IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
-    baked->IndexAdvanceX.resize(new_size, -1.0f);
-    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
+    const int page_n = (int)codepoint >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    if (page_n >= baked->IndexPageMap.Size)
+        baked->IndexPageMap.resize(page_n + 1, 0);
+    if (baked->IndexPageMap.Data[page_n] == 0)
+    {
+        if (baked->IndexLookup.Size == 0) // Shared empty page
+        {
+            baked->IndexAdvanceX.resize(IM_FONTBAKED_INDEX_PAGE_SIZE, -1.0f);
+            baked->IndexLookup.resize(IM_FONTBAKED_INDEX_PAGE_SIZE, IM_FONTGLYPH_INDEX_UNUSED);
+        }
+        baked->IndexPageMap.Data[page_n] = (ImU16)(baked->IndexLookup.Size >> IM_FONTBAKED_INDEX_PAGE_SHIFT);
+        baked->IndexAdvanceX.resize(baked->IndexAdvanceX.Size + IM_FONTBAKED_INDEX_PAGE_SIZE, -1.0f);
+        baked->IndexLookup.resize(baked->IndexLookup.Size + IM_FONTBAKED_INDEX_PAGE_SIZE, IM_FONTGLYPH_INDEX_UNUSED);
+    }
+    return IM_FONTBAKED_INDEX_SLOT(baked, codepoint);
 }
 
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
@@ -4442,6 +5423,15 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         return NULL;
     }
 
+    // Thread-shared atlas: glyph will be loaded by next ImFontAtlasUpdateNewFrame(), use fallback until then.
+    if (ImFontAtlasIsSharedReadOnly(atlas))
+    {
+        ImFontAtlasSharedRequestAdd(atlas, font, baked->Size, baked->RasterizerDensity, codepoint);
+        if (only_load_advance_x != NULL)
+            *only_load_advance_x = baked->FallbackAdvanceX;
+        return NULL;
+    }
+
     // User remapping hooks
     ImWchar src_codepoint = codepoint;
     ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
@@ -4455,13 +5445,15 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
             return glyph;
 
-    // Call backend
+    // Call backend, starting from the first source providing the code-point.
+    // Following sources are still tried in order if loading fails (e.g. loaders without FontSrcContainsGlyph()).
+    const int src_first = ImFontAtlasFontResolveSource(atlas, font, codepoint);
     char* loader_user_data_p = (char*)baked->FontLoaderDatas;
-    int src_n = 0;
-    for (ImFontConfig* src : font->Sources)
+    for (int src_n = 0; src_n < font->Sources.Size && src_first != -1; src_n++)
     {
+        ImFontConfig* src = font->Sources[src_n];
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
-        if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+        if (src_n >= src_first && (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint)))
         {
             if (only_load_advance_x == NULL)
             {
@@ -4485,7 +5477,6 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
             }
         }
         loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
-        src_n++;
     }
 
     // Lazily load fallback glyph
@@ -4495,9 +5486,9 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         ImFontAtlasBuildSetupFontBakedFallback(baked);
 
     // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    const int slot = ImFontBaked_BuildGetIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[slot] = baked->FallbackAdvanceX;
+    baked->IndexLookup[slot] = IM_FONTGLYPH_INDEX_NOT_FOUND;
     return NULL;
 }
 
@@ -4567,8 +5558,47 @@ struct ImGui_ImplStbTrueType_FontSrcData
 {
     stbtt_fontinfo  FontInfo;
     float           ScaleFactor;
+    ImVector<int>   CmapPageMap;        // Code-point page (256 code-points) -> offset into CmapGlyphIndex[], -1 if not built yet. Pages without any glyph all point to offset 0.
+    ImVector<ImU16> CmapGlyphIndex;     // Code-point -> glyph index, for built pages. First page is always zero-filled.
 };
 
+// Cached stbtt_FindGlyphIndex(), which does a binary search in the cmap table on every call.
+// The cache is built lazily one page of 256 code-points at a time, and shared by all baked sizes of a source.
+static int ImGui_ImplStbTrueType_FindGlyphIndex(ImGui_ImplStbTrueType_FontSrcData* bd_font_data, ImWchar codepoint)
+{
+    const int page_n = (int)(codepoint >> 8);
+    if (page_n >= bd_font_data->CmapPageMap.Size)
+        bd_font_data->CmapPageMap.resize(page_n + 1, -1);
+    int page_offset = bd_font_data->CmapPageMap.Data[page_n];
+    if (page_offset == -1)
+    {
+        page_offset = bd_font_data->CmapGlyphIndex.Size;
+        bd_font_data->CmapGlyphIndex.resize(page_offset + 256);
+        ImU16* page = bd_font_data->CmapGlyphIndex.Data + page_offset;
+        int glyphs_count = 0;
+        for (int n = 0; n < 256; n++)
+        {
+            const int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (page_n << 8) + n);
+            page[n] = (ImU16)glyph_index;
+            glyphs_count += (glyph_index != 0);
+        }
+        if (glyphs_count == 0)
+        {
+            bd_font_data->CmapGlyphIndex.resize(page_offset);
+            page_offset = 0;
+        }
+        bd_font_data->CmapPageMap.Data[page_n] = page_offset;
+    }
+    return bd_font_data->CmapGlyphIndex.Data[page_offset + (codepoint & 0xFF)];
+}
+
+void ImFontAtlasStbTrueTypeGetCmapCacheInfo(ImFontConfig* src, int* out_size_in_bytes, int* out_pages_count)
+{
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    *out_size_in_bytes = bd_font_data ? bd_font_data->CmapPageMap.size_in_bytes() + bd_font_data->CmapGlyphIndex.size_in_bytes() : 0;
+    *out_pages_count = bd_font_data ? bd_font_data->CmapGlyphIndex.Size / 256 - 1 : 0;
+}
+
 static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig* src)
 {
     IM_UNUSED(atlas);
@@ -4590,6 +5620,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->CmapGlyphIndex.resize(256, 0);
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4621,7 +5652,7 @@ static bool ImGui_ImplStbTrueType_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFon
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data != NULL);
 
-    int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+    int glyph_index = ImGui_ImplStbTrueType_FindGlyphIndex(bd_font_data, codepoint);
     return glyph_index != 0;
 }
 
@@ -4648,7 +5679,7 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
-    int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+    int glyph_index = ImGui_ImplStbTrueType_FindGlyphIndex(bd_font_data, codepoint);
     if (glyph_index == 0)
         return false;
 
@@ -4685,7 +5716,7 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     {
         const int w = (x1 - x0 + oversample_h - 1);
         const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h, NULL, true);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
             // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
@@ -4735,9 +5766,9 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     return true;
 }
 
-const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
+static ImFontLoader ImGui_ImplStbTrueType_CreateLoader()
 {
-    static ImFontLoader loader;
+    ImFontLoader loader;
     loader.Name = "stb_truetype";
     loader.FontSrcInit = ImGui_ImplStbTrueType_FontSrcInit;
     loader.FontSrcDestroy = ImGui_ImplStbTrueType_FontSrcDestroy;
@@ -4745,6 +5776,12 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    return loader;
+}
+
+const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
+{
+    static const ImFontLoader loader = ImGui_ImplStbTrueType_CreateLoader(); // Thread-safe initialization
     return &loader;
 }
 
@@ -5082,8 +6119,10 @@ void ImFontBaked::ClearOutputData()
 {
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
+    IndexPageMap.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    GlyphsFreeList.clear();
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5108,6 +6147,8 @@ void ImFont::ClearOutputData()
         ImFontAtlasFontDiscardBakes(atlas, this, 0);
     FallbackChar = EllipsisChar = 0;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
+    SourceMapPages.clear();
+    SourceMap.clear();
     LastBaked = NULL;
 }
 
@@ -5129,9 +6170,21 @@ bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last)
 // - 'src' is not necessarily == 'this->Sources' because multiple source fonts+configs can be used to build one target font.
 ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph)
 {
-    int glyph_idx = baked->Glyphs.Size;
-    baked->Glyphs.push_back(*in_glyph);
+    int glyph_idx;
+    if (baked->GlyphsFreeList.Size > 0)
+    {
+        // Reuse entry of an evicted glyph
+        glyph_idx = baked->GlyphsFreeList.back();
+        baked->GlyphsFreeList.pop_back();
+        baked->Glyphs[glyph_idx] = *in_glyph;
+    }
+    else
+    {
+        glyph_idx = baked->Glyphs.Size;
+        baked->Glyphs.push_back(*in_glyph);
+    }
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
+    glyph->LastUsedFrame = baked->LastUsedFrame;
     IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
 
     // Set UV from packed rectangle
@@ -5139,10 +6192,8 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
         IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
-        glyph->U0 = (r->x) * atlas->TexUvScale.x;
-        glyph->V0 = (r->y) * atlas->TexUvScale.y;
-        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
-        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        glyph->PageIdx = ImFontAtlasPackGetRectPageIdx(atlas, glyph->PackId);
+        ImFontAtlasBuildUpdateGlyphUV(atlas, glyph, r);
         baked->MetricsTotalSurface += r->w * r->h;
     }
 
@@ -5167,13 +6218,19 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
-        atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+    {
+        // Colored glyphs stored in a separate RGBA32 page don't make an Alpha8 atlas->TexData use colors.
+        ImTextureData* glyph_tex = (glyph->PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPackGetPageTexture(atlas, glyph->PageIdx) : atlas->TexData;
+        atlas->TexPixelsUseColors = glyph_tex->UseColors = true;
+        if (glyph_tex->Format == atlas->TexData->Format)
+            atlas->TexData->UseColors = true;
+    }
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    const int slot = ImFontBaked_BuildGetIndexSlot(baked, (ImWchar)codepoint);
+    baked->IndexAdvanceX[slot] = glyph->AdvanceX;
+    baked->IndexLookup[slot] = (ImU16)glyph_idx;
     const int page_n = codepoint / 8192;
     baked->OwnerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5199,14 +6256,13 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    baked->IndexAdvanceX[ImFontBaked_BuildGetIndexSlot(baked, codepoint)] = advance_x;
 }
 
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPageIdx(atlas, glyph->PackId));
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5222,13 +6278,16 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (size_t)IndexPageMap.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[IM_FONTBAKED_INDEX_SLOT(this, c)];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return &Glyphs.Data[FallbackGlyphIndex];
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
+        {
+            ImAtomicStoreRelaxed(&Glyphs.Data[i].LastUsedFrame, ImAtomicLoadRelaxed(&LastUsedFrame)); // Stamp for least-recently-used eviction (atomic: may be called from multiple threads with ImFontAtlasFlags_ThreadShared)
             return &Glyphs.Data[i];
+        }
     }
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     return glyph ? glyph : &Glyphs.Data[FallbackGlyphIndex];
@@ -5237,14 +6296,19 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (size_t)IndexPageMap.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[IM_FONTBAKED_INDEX_SLOT(this, c)];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return NULL;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
+        {
+            ImAtomicStoreRelaxed(&Glyphs.Data[i].LastUsedFrame, ImAtomicLoadRelaxed(&LastUsedFrame));
             return &Glyphs.Data[i];
+        }
     }
+    if (ImFontAtlasIsSharedReadOnly(OwnerFont->OwnerAtlas))
+        return ImFontBaked_BuildLoadGlyph(this, c, NULL); // Will only record a request, can't write LoadNoFallback
     LoadNoFallback = true; // This is actually a rare call, not done in hot-loop, so we prioritize not adding extra cruft to ImFontBaked_BuildLoadGlyph() call sites.
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     LoadNoFallback = false;
@@ -5253,9 +6317,9 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (size_t)IndexPageMap.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[IM_FONTBAKED_INDEX_SLOT(this, c)];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return false;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5264,28 +6328,42 @@ bool ImFontBaked::IsGlyphLoaded(ImWchar c)
     return false;
 }
 
-// This is not fast query
+// Only the first query for a given code-point probes font sources, see ImFontAtlasFontResolveSource().
+// With ImFontAtlasFlags_ThreadShared, queries from contexts are serialized as they update lookup caches.
 bool ImFont::IsGlyphInFont(ImWchar c)
 {
     ImFontAtlas* atlas = OwnerAtlas;
+    ImFontAtlasBuilder* shared_builder = ImFontAtlasIsSharedReadOnly(atlas) ? atlas->Builder : NULL;
+    if (shared_builder)
+        while (!ImAtomicCompareExchange(&shared_builder->SharedRequestsLock, 0, 1))
+            ImThreadYield();
+
+    bool ret = false;
     ImFontAtlas_FontHookRemapCodepoint(atlas, this, &c);
-    for (ImFontConfig* src : Sources)
+    const int src_first = ImFontAtlasFontResolveSource(atlas, this, c);
+    for (int src_n = src_first; src_n < Sources.Size && src_first != -1 && !ret; src_n++)
     {
+        ImFontConfig* src = Sources[src_n];
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
-        if (loader->FontSrcContainsGlyph != NULL && loader->FontSrcContainsGlyph(atlas, src, c))
-            return true;
+        if (loader->FontSrcContainsGlyph == NULL || (src->GlyphExcludeRanges && !ImFontAtlasBuildAcceptCodepointForSource(src, c)))
+            continue; // Source was resolved because its loader cannot be queried: keep looking.
+        if (src_n == src_first || loader->FontSrcContainsGlyph(atlas, src, c))
+            ret = true;
     }
-    return false;
+
+    if (shared_builder)
+        ImAtomicStore(&shared_builder->SharedRequestsLock, 0);
+    return ret;
 }
 
 // This is manually inlined in CalcTextSizeA() and CalcWordWrapPosition(), with a non-inline call to BuildLoadGlyphGetAdvanceOrFallback().
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
+    if ((int)(c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < IndexPageMap.Size)
     {
         // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
+        const float x = IndexAdvanceX.Data[IM_FONTBAKED_INDEX_SLOT(this, c)];
         if (x >= 0.0f)
             return x;
     }
@@ -5303,9 +6381,11 @@ ImGuiID ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterize
 }
 
 // ImFontBaked pointers are valid for the entire frame but shall never be kept between frames.
+// With ImFontAtlasFlags_ThreadShared, LastBaked is not used: it would be written by multiple threads.
 ImFontBaked* ImFont::GetFontBaked(float size, float density)
 {
-    ImFontBaked* baked = LastBaked;
+    const bool thread_shared = (OwnerAtlas->Flags & ImFontAtlasFlags_ThreadShared) != 0;
+    ImFontBaked* baked = thread_shared ? NULL : LastBaked;
 
     // Round font size
     // - ImGui::PushFont() will already round, but other paths calling GetFontBaked() directly also needs it (e.g. ImFontAtlasBuildPreloadAllGlyphRanges)
@@ -5321,8 +6401,9 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
         return NULL;
-    baked->LastUsedFrame = builder->FrameCount;
-    LastBaked = baked;
+    ImAtomicStoreRelaxed(&baked->LastUsedFrame, builder->FrameCount);
+    if (!thread_shared)
+        LastBaked = baked;
     return baked;
 }
 
@@ -5333,8 +6414,9 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     IM_ASSERT(font_size > 0.0f && font_rasterizer_density > 0.0f);
     ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density);
     ImFontAtlasBuilder* builder = atlas->Builder;
-    ImFontBaked** p_baked_in_map = (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
-    ImFontBaked* baked = *p_baked_in_map;
+    const bool shared_read_only = ImFontAtlasIsSharedReadOnly(atlas);
+    ImFontBaked** p_baked_in_map = shared_read_only ? NULL : (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
+    ImFontBaked* baked = shared_read_only ? (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id) : *p_baked_in_map;
     if (baked != NULL)
     {
         IM_ASSERT(baked->Size == font_size && baked->OwnerFont == font && baked->BakedId == baked_id);
@@ -5342,9 +6424,12 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     }
 
     // If atlas is locked, find closest match
+    // Thread-shared atlas: size will be baked by next ImFontAtlasUpdateNewFrame(), use closest match until then.
     // FIXME-OPT: This is not an optimal query.
-    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked)
+    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked || shared_read_only)
     {
+        if (shared_read_only && !(font->Flags & ImFontFlags_LockBakedSizes))
+            ImFontAtlasSharedRequestAdd(atlas, font, font_size, font_rasterizer_density, 0);
         baked = ImFontAtlasBakedGetClosestMatch(atlas, font, font_size, font_rasterizer_density);
         if (baked != NULL)
             return baked;
@@ -5353,6 +6438,11 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
             IM_ASSERT(!atlas->Locked && "Cannot use dynamic font size with a locked ImFontAtlas!"); // Locked because rendering backend does not support ImGuiBackendFlags_RendererHasTextures!
             return NULL;
         }
+        if (shared_read_only)
+        {
+            IM_ASSERT(0 && "Font has no baked size yet. Call ImFontAtlasUpdateNewFrame() before other threads use the atlas.");
+            return NULL;
+        }
     }
 
     // Create new
@@ -5424,7 +6514,7 @@ const char* ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* t
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (unsigned int)baked->IndexPageMap.Size) ? baked->IndexAdvanceX.Data[IM_FONTBAKED_INDEX_SLOT(baked, c)] : -1.0f;
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
 
@@ -5483,6 +6573,274 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
     return ImFontCalcWordWrapPositionEx(this, size, text, text_end, wrap_width, ImDrawTextFlags_None);
 }
 
+// Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
+static inline float ImFontWrapLayoutGetCharAdvance(ImFontBaked* baked, unsigned int c)
+{
+    float char_width = ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (unsigned int)baked->IndexPageMap.Size) ? baked->IndexAdvanceX.Data[IM_FONTBAKED_INDEX_SLOT(baked, c)] : -1.0f;
+    if (char_width < 0.0f)
+        char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+    return char_width;
+}
+
+void ImFontWrapLayout::Clear()
+{
+    Font = NULL;
+    Baked = NULL;
+    FontSize = Scale = 0.0f;
+    TextLen = 0;
+    Breaks.resize(0);
+    NewLines.resize(0);
+    ResumeOffset = ResumeWordEnd = 0;
+    ResumeAdvanceSum = 0.0f;
+    ResumeInsideWord = true;
+}
+
+// This runs the same state machine as ImFontCalcWordWrapPositionEx() once over the whole text, recording each word start with the
+// end of the previous word and the advance preceding it. The state only differs for the first character of a line, which
+// CalcWordWrapPosition() accounts for.
+void ImFontWrapLayout::Build(ImFont* font, float size, const char* text, const char* text_end)
+{
+    if (Font != font || FontSize != size || TextLen > (int)(text_end - text))
+        Clear();
+    Font = font;
+    FontSize = size;
+    Baked = font->GetFontBaked(size);
+    Scale = size / Baked->Size;
+
+    // Resume from last character (appended text may complete its UTF-8 sequence)
+    int offset = ResumeOffset;
+    int word_end = ResumeWordEnd;
+    float advance_sum = ResumeAdvanceSum;
+    bool inside_word = ResumeInsideWord;
+    while (Breaks.Size > 0 && Breaks.back().Offset >= offset)
+        Breaks.pop_back();
+    if (NewLines.Size > 0 && NewLines.back() >= offset)
+        NewLines.pop_back();
+
+    ImFontBaked* baked = Baked;
+    const char* s = text + offset;
+    while (s < text_end)
+    {
+        ResumeOffset = offset;
+        ResumeWordEnd = word_end;
+        ResumeAdvanceSum = advance_sum;
+        ResumeInsideWord = inside_word;
+
+        unsigned int c = (unsigned int)*s;
+        const char* next_s;
+        if (c < 0x80)
+            next_s = s + 1;
+        else
+            next_s = s + ImTextCharFromUtf8(&c, s, text_end);
+        const int next_offset = (int)(next_s - text);
+
+        if (c == '\n')
+        {
+            NewLines.push_back(offset);
+            inside_word = true;
+            advance_sum = 0.0f; // Lines never span a '\n': restart sums so they stay small and precise as floats
+        }
+        else if (c != '\r')
+        {
+            const float char_width = ImFontWrapLayoutGetCharAdvance(baked, c);
+            if (ImCharIsBlankW(c))
+            {
+                if (inside_word)
+                    word_end = offset;
+                inside_word = false;
+            }
+            else
+            {
+                if (inside_word)
+                {
+                    word_end = next_offset;
+                }
+                else
+                {
+                    ImFontWrapLayoutBreak brk = { offset, word_end, advance_sum };
+                    Breaks.push_back(brk);
+                }
+                inside_word = (c != '.' && c != ',' && c != ';' && c != '!' && c != '?' && c != '\"' && c != 0x3001 && c != 0x3002);
+            }
+            advance_sum += char_width;
+        }
+        offset = next_offset;
+        s = next_s;
+    }
+    TextLen = (int)(text_end - text);
+}
+
+static const int* ImFontWrapLayoutLowerBound(const int* in_begin, const int* in_end, int value)
+{
+    size_t count = (size_t)(in_end - in_begin);
+    while (count > 0)
+    {
+        size_t count2 = count >> 1;
+        const int* mid = in_begin + count2;
+        if (*mid < value)
+        {
+            in_begin = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return in_begin;
+}
+
+// First break with Offset >= offset
+static const ImFontWrapLayoutBreak* ImFontWrapLayoutLowerBound(const ImFontWrapLayoutBreak* in_begin, const ImFontWrapLayoutBreak* in_end, int offset)
+{
+    size_t count = (size_t)(in_end - in_begin);
+    while (count > 0)
+    {
+        size_t count2 = count >> 1;
+        const ImFontWrapLayoutBreak* mid = in_begin + count2;
+        if (mid->Offset < offset)
+        {
+            in_begin = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return in_begin;
+}
+
+// Walk characters from the closest preceding word start or paragraph start.
+float ImFontWrapLayout::CalcAdvanceSum(const char* text, int offset) const
+{
+    const int* newline = ImFontWrapLayoutLowerBound(NewLines.begin(), NewLines.end(), offset);
+    const int paragraph_offset = (newline > NewLines.begin()) ? newline[-1] + 1 : 0;
+    const ImFontWrapLayoutBreak* brk = ImFontWrapLayoutLowerBound(Breaks.begin(), Breaks.end(), offset + 1);
+    float advance_sum = 0.0f;
+    const char* s = text + paragraph_offset;
+    if (brk > Breaks.begin() && brk[-1].Offset >= paragraph_offset)
+    {
+        advance_sum = brk[-1].AdvanceSum;
+        s = text + brk[-1].Offset;
+    }
+    const char* text_end = text + TextLen;
+    const char* s_end = text + offset;
+    while (s < s_end)
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c != '\r')
+            advance_sum += ImFontWrapLayoutGetCharAdvance(Baked, c);
+    }
+    return advance_sum;
+}
+
+// Same result as ImFontCalcWordWrapPositionEx(font, size, text + line_offset, text + TextLen, wrap_width, flags), but O(log N).
+// Returns a byte offset. 'text' is the beginning of the text given to Build().
+int ImFontWrapLayout::CalcWordWrapPosition(const char* text, int line_offset, float wrap_width, ImDrawTextFlags flags) const
+{
+    IM_ASSERT(Baked != NULL && line_offset < TextLen);
+    const char* text_end = text + TextLen;
+
+    // Stop at end of paragraph
+    int limit_offset = TextLen;
+    const int* newline = ImFontWrapLayoutLowerBound(NewLines.begin(), NewLines.end(), line_offset);
+    if (newline < NewLines.end())
+        limit_offset = *newline;
+
+    // State machine starts on first character other than '\r'
+    int start_offset = line_offset;
+    while (start_offset < limit_offset && text[start_offset] == '\r')
+        start_offset++;
+    if (start_offset == limit_offset)
+        return limit_offset;
+
+    // Last word start of the line preceded by text fitting within wrap width
+    const float wrap_width_unscaled = wrap_width / Scale;
+    const float base = CalcAdvanceSum(text, line_offset);
+    const ImFontWrapLayoutBreak* breaks_begin = ImFontWrapLayoutLowerBound(Breaks.begin(), Breaks.end(), start_offset + 1);
+    const ImFontWrapLayoutBreak* breaks_end = ImFontWrapLayoutLowerBound(breaks_begin, Breaks.end(), limit_offset);
+    const ImFontWrapLayoutBreak* lo = breaks_begin;
+    const ImFontWrapLayoutBreak* hi = breaks_end;
+    while (lo < hi)
+    {
+        const ImFontWrapLayoutBreak* mid = lo + ((hi - lo) >> 1);
+        if (mid->AdvanceSum - base <= wrap_width_unscaled)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Walk from there to first non-blank character overflowing (blanks don't count toward width until followed by a word)
+    const char* s = (lo > breaks_begin) ? text + lo[-1].Offset : text + start_offset;
+    float advance_sum = (lo > breaks_begin) ? lo[-1].AdvanceSum : base;
+    const char* s_limit = text + limit_offset;
+    const char* overflow = NULL;
+    while (s < s_limit)
+    {
+        unsigned int c = (unsigned int)*s;
+        const char* next_s;
+        if (c < 0x80)
+            next_s = s + 1;
+        else
+            next_s = s + ImTextCharFromUtf8(&c, s, text_end);
+        if (c != '\r')
+        {
+            advance_sum += ImFontWrapLayoutGetCharAdvance(Baked, c);
+            if (advance_sum - base > wrap_width_unscaled && !ImCharIsBlankW(c))
+            {
+                overflow = s;
+                break;
+            }
+        }
+        s = next_s;
+    }
+    if (overflow == NULL)
+        return limit_offset;
+    const int overflow_offset = (int)(overflow - text);
+
+    // Last word start as seen from a state machine starting at 'start_offset' (where first character always updates word end).
+    // Without one, the line is a single word overflowing: cut anywhere.
+    int wrap_offset = overflow_offset;
+    const ImFontWrapLayoutBreak* word = ImFontWrapLayoutLowerBound(breaks_begin, breaks_end, overflow_offset + 1);
+    if (word > breaks_begin)
+    {
+        word--;
+        unsigned int c = (unsigned int)text[word->Offset];
+        if (c >= 0x80)
+            ImTextCharFromUtf8(&c, text + word->Offset, text_end);
+        const float word_start_sum = word->AdvanceSum + ImFontWrapLayoutGetCharAdvance(Baked, c);
+        const float word_width = (word->Offset == overflow_offset) ? 0.0f : advance_sum - word_start_sum; // Excluding word start character, as ImFontCalcWordWrapPositionEx()
+        if (word_width < wrap_width_unscaled)
+        {
+            if ((flags & ImDrawTextFlags_WrapKeepBlanks) && word_start_sum - base <= wrap_width_unscaled)
+                wrap_offset = word->Offset;
+            else if (word->PrevWordEnd > start_offset)
+                wrap_offset = word->PrevWordEnd;
+            else
+            {
+                unsigned int start_c = (unsigned int)text[start_offset];
+                const int start_len = (start_c < 0x80) ? 1 : ImTextCharFromUtf8(&start_c, text + start_offset, text_end);
+                wrap_offset = ImCharIsBlankW(start_c) ? start_offset : start_offset + start_len;
+            }
+        }
+    }
+
+    // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+    if (wrap_offset == line_offset)
+        return line_offset + ImTextCountUtf8BytesFromChar(text + line_offset, text_end);
+    return wrap_offset;
+}
+
+float ImFontWrapLayout::CalcTextWidth(const char* text, int begin_offset, int end_offset) const
+{
+    return (CalcAdvanceSum(text, end_offset) - CalcAdvanceSum(text, begin_offset)) * Scale;
+}
+
 ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end_display, const char* text_end, const char** out_remaining, ImVec2* out_offset, ImDrawTextFlags flags)
 {
     if (!text_end)
@@ -5545,7 +6903,7 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
             continue;
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = ((c >> IM_FONTBAKED_INDEX_PAGE_SHIFT) < (unsigned int)baked->IndexPageMap.Size) ? baked->IndexAdvanceX.Data[IM_FONTBAKED_INDEX_SLOT(baked, c)] : -1.0f;
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
         char_width *= scale;
@@ -5614,14 +6972,30 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    // Glyph in another texture page: switch texture without touching _TextureStack[] (which may be empty), then restore it.
+    const ImTextureRef tex_ref_on_entry = draw_list->_CmdHeader.TexRef;
+    if (glyph->PageIdx != 0)
+    {
+        draw_list->_CmdHeader.TexRef = ImFontAtlasPackGetPageTexRef(OwnerAtlas, glyph->PageIdx);
+        draw_list->_OnChangedTexture();
+    }
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (glyph->PageIdx != 0)
+    {
+        draw_list->_CmdHeader.TexRef = tex_ref_on_entry;
+        draw_list->_OnChangedTexture();
+    }
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 // DO NOT CALL DIRECTLY THIS WILL CHANGE WILDLY IN 2025-2025. Use ImDrawList::AddText().
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags)
 {
+    IMGUI_PROFILER_SCOPE("RenderText");
+
+    const ImTextureRef tex_ref_on_entry = draw_list->_CmdHeader.TexRef; // Restored after switching texture page (may not be the top of _TextureStack[], which may be empty)
+
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
@@ -5678,19 +7052,24 @@ begin:
         return;
 
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    int vtx_count_max = (int)(text_end - s) * 4;
+    int idx_count_max = (int)(text_end - s) * 6;
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
-    const int cmd_count = draw_list->CmdBuffer.Size;
+    int cmd_count = draw_list->CmdBuffer.Size;
+    int page_idx = 0; // Texture page currently bound, see ImFontAtlas::TexPageWidth
     const bool cpu_fine_clip = (flags & ImDrawTextFlags_CpuFineClip) != 0;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
 
+    // Past this position, remaining glyphs of a line can't be visible: skip to end of line.
+    // (margin is for glyphs with a negative X0 offset, which would be visible at the edge of the clip rectangle)
+    const float clip_skip_line_x = clip_rect.z + line_height;
+
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -5785,6 +7164,29 @@ begin:
                 // Support for untinted glyphs
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
+                // Switch texture page: give back unused vertices, change texture and reserve again for remaining characters.
+                // We don't call _SetTexture() as we want to leave _TextureStack[] untouched.
+                if (glyph->PageIdx != page_idx) IM_UNLIKELY
+                {
+                    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+                    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+                    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+                    draw_list->_VtxWritePtr = vtx_write;
+                    draw_list->_IdxWritePtr = idx_write;
+                    draw_list->_VtxCurrentIdx = vtx_index;
+                    page_idx = glyph->PageIdx;
+                    draw_list->_CmdHeader.TexRef = ImFontAtlasPackGetPageTexRef(OwnerAtlas, page_idx);
+                    draw_list->_OnChangedTexture();
+                    vtx_count_max = (int)(text_end - s + 1) * 4;
+                    idx_count_max = (int)(text_end - s + 1) * 6;
+                    idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+                    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                    cmd_count = draw_list->CmdBuffer.Size;
+                }
+
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
@@ -5800,6 +7202,17 @@ begin:
             }
         }
         x += char_width;
+
+        // Skip remaining glyphs of a line when they are past the clip rectangle (e.g. very long lines)
+        if (x > clip_skip_line_x)
+        {
+            if (word_wrap_enabled)
+                s = ImMax(s, word_wrap_eol);
+            else if (const char* line_end = (const char*)ImMemchr(s, '\n', text_end - s))
+                s = line_end;
+            else
+                break;
+        }
     }
 
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
@@ -5809,6 +7222,11 @@ begin:
         draw_list->CmdBuffer.pop_back();
         draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
+        if (page_idx != 0)
+        {
+            draw_list->_CmdHeader.TexRef = tex_ref_on_entry;
+            draw_list->_OnChangedTexture();
+        }
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
         goto begin;
@@ -5823,6 +7241,13 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+
+    // Restore texture after switching page
+    if (page_idx != 0)
+    {
+        draw_list->_CmdHeader.TexRef = tex_ref_on_entry;
+        draw_list->_OnChangedTexture();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -6047,9 +7472,9 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+static IM_THREAD_LOCAL unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static IM_THREAD_LOCAL const unsigned char *stb__barrier_in_b;
+static IM_THREAD_LOCAL unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
@@ -39,6 +39,7 @@ Index of this file:
 // [SECTION] ImGui internal API
 // [SECTION] ImFontLoader
 // [SECTION] ImFontAtlas internal API
+// [SECTION] Profiler zones (IMGUI_ENABLE_PROFILER)
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 
 */
@@ -63,13 +64,16 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
 #endif
 #endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
-#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
+#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_USE_FAST_HASH) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
 
@@ -121,6 +125,9 @@ Index of this file:
 #ifdef IMGUI_DISABLE_MATH_FUNCTIONS                     // Renamed in 1.74
 #error Use IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS
 #endif
+#if defined(IMGUI_USE_FAST_HASH) && defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#error Cannot use both IMGUI_USE_FAST_HASH and IMGUI_USE_LEGACY_CRC32_ADLER!
+#endif
 
 // Enable stb_truetype by default unless FreeType is enabled.
 // You can compile with both by defining both IMGUI_ENABLE_FREETYPE and IMGUI_ENABLE_STB_TRUETYPE together.
@@ -141,9 +148,20 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
-struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasBuilder;          // Glyph which may be evicted by ImFontAtlasBuildEvictGlyphs()
+struct ImFontAtlasEvictEntry
+{
+    int                         LastUsedFrame;
+    int                         BakedIdx;
+    int                         GlyphIdx;
+};
+
+// Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasDefragCandidate;  // Glyph which may be moved by ImFontAtlasPackDefragStep()
+struct ImFontAtlasEvictEntry;       // Glyph which may be evicted by ImFontAtlasBuildEvictGlyphs()
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
+struct ImFontAtlasSharedRequest;    // Glyph or size request made by a context using a thread-shared atlas
 
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
@@ -157,6 +175,7 @@ struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/End
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
 struct ImGuiLastItemData;           // Status storage for last submitted items
+struct ImGuiTextLineCache;          // Cached visual line index of a large text buffer submitted to TextEx()
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiMultiSelectState;       // Multi-selection persistent state (for focused selection).
@@ -168,6 +187,7 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for built-in CPU profiler (frames and zones)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiStyleVarInfo;           // Style variable information (e.g. to access style variables from an enum)
@@ -184,6 +204,7 @@ struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHitGrid;          // Spatial index of windows rectangles, to find hovered window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -221,8 +242,14 @@ typedef ImU16 ImGuiTableDrawChannelIdx;
 // See implementation of this variable in imgui.cpp for comments and details.
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#define IM_THREAD_LOCAL     thread_local
+#else
+#define IM_THREAD_LOCAL
+#endif
+
 #ifndef GImGui
-extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
+extern IMGUI_API IM_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
 
 //-----------------------------------------------------------------------------
@@ -343,6 +370,8 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 //-----------------------------------------------------------------------------
 // - Helpers: Hashing
 // - Helpers: Sorting
+// - Helpers: Color Blending
+// - Helpers: Atomics
 // - Helpers: Bit manipulation
 // - Helpers: String
 // - Helpers: Formatting
@@ -366,8 +395,41 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashDataFast(const void* data, size_t data_size, ImGuiID seed = 0); // Not compatible with ImHashData(): for large contents (e.g. text), not IDs.
 IMGUI_API const char*   ImHashSkipUncontributingPrefix(const char* label);
 
+// Helpers: Compile-time Hashing
+// - ImHashStrConst("label") == ImHashStr("label"), with support for ### and seeding, usable in constant expressions.
+//   Chain them to precompute window-relative IDs, e.g. 'constexpr ImGuiID id = ImHashStrConst("OK", ImHashStrConst("My Window"));'.
+// - Evaluation is recursive: keep constant strings short (compilers limit constexpr recursion depth, typically 512).
+// - Same result as runtime functions for all hash settings (CRC32c, IMGUI_USE_LEGACY_CRC32_ADLER, IMGUI_USE_FAST_HASH).
+namespace ImHashConst
+{
+    constexpr size_t    StrLen(const char* s, size_t n = 0)                                 { return s[n] ? StrLen(s, n + 1) : n; }
+    constexpr const char* SkipUncontributingPrefix(const char* s, const char* result)       { return *s == 0 ? result : SkipUncontributingPrefix(s + 1, (s[0] == '#' && s[1] == '#' && s[2] == '#') ? s : result); }
+#ifdef IMGUI_USE_FAST_HASH
+    constexpr ImU64     Rotl(ImU64 v, int r)                                                { return (v << r) | (v >> (64 - r)); }
+    constexpr ImU64     Read(const char* p, size_t n)                                       { return n == 0 ? 0 : (ImU64)(unsigned char)p[0] | (Read(p + 1, n - 1) << 8); }
+    constexpr ImU64     Round(ImU64 h, ImU64 w)                                             { return Rotl(h ^ (Rotl(w * 0xC2B2AE3D27D4EB4FULL, 31) * 0x9E3779B185EBCA87ULL), 27) * 0x9E3779B185EBCA87ULL + 0x85EBCA77C2B2AE63ULL; }
+    constexpr ImU64     Tail(ImU64 h, ImU64 w)                                              { return Rotl(h ^ (w * 0x9E3779B185EBCA87ULL), 23) * 0xC2B2AE3D27D4EB4FULL + 0x165667B19E3779F9ULL; }
+    constexpr ImU64     Avalanche3(ImU64 h)                                                 { return h ^ (h >> 32); }
+    constexpr ImU64     Avalanche2(ImU64 h)                                                 { return Avalanche3((h ^ (h >> 29)) * 0x165667B19E3779F9ULL); }
+    constexpr ImU64     Avalanche(ImU64 h)                                                  { return Avalanche2((h ^ (h >> 33)) * 0xC2B2AE3D27D4EB4FULL); }
+    constexpr ImU64     Words(const char* p, size_t n, ImU64 h)                             { return n >= 8 ? Words(p + 8, n - 8, Round(h, Read(p, 8))) : n > 0 ? Tail(h, Read(p, n)) : h; }
+    constexpr ImGuiID   Data(const char* p, size_t n, ImGuiID seed)                         { return n == 0 ? seed : (ImGuiID)Avalanche(Words(p, n, (ImU64)seed + 0x27D4EB2F165667C5ULL + n)); }
+    constexpr ImGuiID   Str(const char* s, ImGuiID seed)                                    { return Data(SkipUncontributingPrefix(s, s), StrLen(SkipUncontributingPrefix(s, s)), seed); }
+#else
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+    constexpr ImU32     Crc32Bits(ImU32 crc, int bits)                                      { return bits == 0 ? crc : Crc32Bits((crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u))), bits - 1); }
+#else
+    constexpr ImU32     Crc32Bits(ImU32 crc, int bits)                                      { return bits == 0 ? crc : Crc32Bits((crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u))), bits - 1); }
+#endif
+    constexpr ImU32     Crc32Str(const char* s, ImU32 crc)                                  { return *s == 0 ? crc : Crc32Str(s + 1, Crc32Bits(crc ^ (unsigned char)*s, 8)); }
+    constexpr ImGuiID   Str(const char* s, ImGuiID seed)                                    { return ~Crc32Str(SkipUncontributingPrefix(s, s), ~seed); }
+#endif
+}
+constexpr ImGuiID       ImHashStrConst(const char* str, ImGuiID seed = 0)                   { return ImHashConst::Str(str, seed); }
+
 // Helpers: Sorting
 #ifndef ImQsort
 inline void             ImQsort(void* base, size_t count, size_t size_of_element, int(IMGUI_CDECL *compare_func)(void const*, void const*)) { if (count > 1) qsort(base, count, size_of_element, compare_func); }
@@ -376,6 +438,37 @@ inline void             ImQsort(void* base, size_t count, size_t size_of_element
 // Helpers: Color Blending
 IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 
+// Helpers: Atomics (for data shared between contexts which may live in different threads)
+// - ImAtomicLoad()/ImAtomicStore() have acquire/release semantic. The Relaxed variants only guarantee the access itself is atomic (e.g. for statistics/stamps).
+#if defined(_MSC_VER)
+#include <intrin.h>     // _InterlockedExchangeAdd, _InterlockedCompareExchange
+inline int              ImAtomicAdd(volatile int* p, int v) { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v; }
+inline bool             ImAtomicCompareExchange(volatile int* p, int expected, int desired) { return _InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == (long)expected; }
+inline int              ImAtomicLoad(volatile int* p) { return (int)_InterlockedOr((volatile long*)p, 0); }
+inline void             ImAtomicStore(volatile int* p, int v) { _InterlockedExchange((volatile long*)p, (long)v); }
+inline int              ImAtomicLoadRelaxed(volatile int* p) { return *p; }
+inline void             ImAtomicStoreRelaxed(volatile int* p, int v) { *p = v; }
+#elif defined(__GNUC__) || defined(__clang__)
+inline int              ImAtomicAdd(volatile int* p, int v) { return __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL); }
+inline bool             ImAtomicCompareExchange(volatile int* p, int expected, int desired) { return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+inline int              ImAtomicLoad(volatile int* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+inline void             ImAtomicStore(volatile int* p, int v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+inline int              ImAtomicLoadRelaxed(volatile int* p) { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+inline void             ImAtomicStoreRelaxed(volatile int* p, int v) { __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+#else
+// FIXME: Not atomic on this compiler. Fine for single-threaded use, but the thread-sharing features can't be used: ImFontAtlasFlags_ThreadShared asserts when IMGUI_ATOMICS_UNSUPPORTED is defined.
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#error "IMGUI_ENABLE_THREAD_LOCAL_CONTEXT requires atomics (ImAtomicXXX helpers), which are only implemented for MSVC, GCC and Clang."
+#endif
+#define IMGUI_ATOMICS_UNSUPPORTED
+inline int              ImAtomicAdd(volatile int* p, int v) { return *p += v; } // FIXME: Not atomic on this compiler.
+inline bool             ImAtomicCompareExchange(volatile int* p, int expected, int desired) { if (*p != expected) return false; *p = desired; return true; } // FIXME: Not atomic on this compiler.
+inline int              ImAtomicLoad(volatile int* p) { return *p; }
+inline void             ImAtomicStore(volatile int* p, int v) { *p = v; }
+inline int              ImAtomicLoadRelaxed(volatile int* p) { return *p; }
+inline void             ImAtomicStoreRelaxed(volatile int* p, int v) { *p = v; }
+#endif
+
 // Helpers: Bit manipulation
 inline bool             ImIsPowerOfTwo(int v)               { return v != 0 && (v & (v - 1)) == 0; }
 inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (v & (v - 1)) == 0; }
@@ -441,6 +534,41 @@ IMGUI_API ImVec2        ImFontCalcTextSizeEx(ImFont* font, float size, float max
 IMGUI_API const char*   ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, ImDrawTextFlags flags = 0);
 IMGUI_API const char*   ImTextCalcWordWrapNextLineStart(const char* text, const char* text_end, ImDrawTextFlags flags = 0); // trim trailing space and find beginning of next line
 
+// Helper: ImFontWrapLayout
+// Word-wrapping data for a given text and font size: break opportunities (word starts) with the cumulative advance preceding them,
+// so word-wrapping at any width is a binary search plus a walk over a few characters, instead of a walk over each character of the line.
+// Only word starts and new lines are stored (~12 bytes per word). CalcWordWrapPosition() returns the same thing as ImFontCalcWordWrapPositionEx().
+// Appended text may be added with Build(). Call Build() before other functions on a given frame, as it refreshes the baked font pointer.
+struct ImFontWrapLayoutBreak
+{
+    int                 Offset;             // Byte offset of word start (non-blank character following a blank or a punctuation)
+    int                 PrevWordEnd;        // Byte offset of end of previous word: where a line may be cut before this word
+    float               AdvanceSum;         // Unscaled advance of text preceding word start, since start of its paragraph
+};
+
+struct IMGUI_API ImFontWrapLayout
+{
+    ImFont*             Font;
+    float               FontSize;
+    ImFontBaked*        Baked;              // Set by Build()
+    float               Scale;              // FontSize / baked size
+    int                 TextLen;
+    ImVector<ImFontWrapLayoutBreak> Breaks;
+    ImVector<int>       NewLines;           // Byte offset of each '\n'
+    int                 ResumeOffset;       // State before last character, which Build() lays out again (appended text may complete its UTF-8 sequence)
+    int                 ResumeWordEnd;
+    float               ResumeAdvanceSum;
+    bool                ResumeInsideWord;
+
+    ImFontWrapLayout()  { Font = NULL; Baked = NULL; FontSize = Scale = 0.0f; TextLen = 0; ResumeOffset = ResumeWordEnd = 0; ResumeAdvanceSum = 0.0f; ResumeInsideWord = true; }
+    void                Clear();            // Keep allocated memory
+    void                ClearFreeMemory()   { Clear(); Breaks.clear(); NewLines.clear(); }
+    void                Build(ImFont* font, float size, const char* text, const char* text_end);   // Layout new text, or only the appended part if font/size are unchanged
+    int                 CalcWordWrapPosition(const char* text, int line_offset, float wrap_width, ImDrawTextFlags flags = 0) const;  // Byte offsets. 'text' is the beginning of the text given to Build().
+    float               CalcTextWidth(const char* text, int begin_offset, int end_offset) const;    // Offsets must be within a same paragraph.
+    float               CalcAdvanceSum(const char* text, int offset) const;                         // Unscaled advance of paragraph text preceding offset.
+};
+
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
@@ -462,6 +590,14 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API void*             ImFileMap(const char* filename, size_t* out_file_size);    // Map file read-only into memory (Windows, POSIX). Return NULL if unsupported or failed.
+IMGUI_API void              ImFileUnmap(void* data, size_t file_size);
+
+// Helpers: Time
+IMGUI_API double            ImTimeGetSeconds();     // High resolution monotonic clock, in seconds, with an arbitrary origin (Windows, POSIX). Return 0.0 if unsupported.
+
+// Helpers: Threads
+IMGUI_API void              ImThreadYield();        // Give up the remainder of the current thread time slice (Windows, POSIX). Used by spin locks.
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -743,6 +879,48 @@ struct ImStableVector
     inline T*           push_back(const T& v)       { int i = Size; IM_ASSERT(i >= 0); if (Size == Capacity) reserve(Capacity + BLOCKSIZE); void* ptr = &Blocks[i / BLOCKSIZE][i % BLOCKSIZE]; memcpy(ptr, &v, sizeof(v)); Size++; return (T*)ptr; }
 };
 
+// Helper: ImRingBuffer<>
+// FIFO queue over a circular buffer. Storage is only (re)allocated by reserve(), or by push_back() when full.
+// - push_back() never loses items: when full, storage is doubled and unwrapped.
+// - push_back_overwrite() never allocates once reserved: when full, the oldest item is discarded.
+// Important: does not construct or destruct anything, items are copied with memcpy().
+template<typename T>
+struct ImRingBuffer
+{
+    int                 Size;       // Number of items
+    int                 Head;       // Index of first item in Storage[]
+    ImVector<T>         Storage;    // Storage.Size == capacity
+
+    // Functions
+    inline ImRingBuffer()                           { Size = Head = 0; }
+
+    inline bool         empty() const               { return Size == 0; }
+    inline int          size() const                { return Size; }
+    inline int          capacity() const            { return Storage.Size; }
+    inline void         clear()                     { Size = Head = 0; Storage.clear(); }
+    inline void         resize(int new_size)        { IM_ASSERT(new_size >= 0 && new_size <= Size); Size = new_size; if (Size == 0) Head = 0; }
+    inline void         reserve(int new_cap)
+    {
+        if (new_cap <= Storage.Size)
+            return;
+        ImVector<T> new_storage;
+        new_storage.resize(new_cap);
+        for (int n = 0; n < Size; n++)
+            memcpy((void*)&new_storage.Data[n], (const void*)&(*this)[n], sizeof(T));
+        Storage.swap(new_storage);
+        Head = 0;
+    }
+    inline T&           operator[](int i)           { IM_ASSERT(i >= 0 && i < Size); int n = Head + i; if (n >= Storage.Size) n -= Storage.Size; return Storage.Data[n]; }
+    inline const T&     operator[](int i) const     { IM_ASSERT(i >= 0 && i < Size); int n = Head + i; if (n >= Storage.Size) n -= Storage.Size; return Storage.Data[n]; }
+    inline T&           front()                     { return (*this)[0]; }
+    inline const T&     front() const               { return (*this)[0]; }
+    inline T&           back()                      { return (*this)[Size - 1]; }
+    inline const T&     back() const                { return (*this)[Size - 1]; }
+    inline T*           push_back(const T& v)       { if (Size == Storage.Size) reserve(Storage.Size ? Storage.Size * 2 : 8); Size++; T* p = &back(); memcpy((void*)p, (const void*)&v, sizeof(v)); return p; }
+    inline T*           push_back_overwrite(const T& v) { IM_ASSERT(Storage.Size > 0); if (Size == Storage.Size) pop_front(1); return push_back(v); }
+    inline void         pop_front(int count)        { IM_ASSERT(count >= 0 && count <= Size); Size -= count; Head = (Size == 0) ? 0 : (Head + count) % Storage.Size; }
+};
+
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
@@ -1105,6 +1283,7 @@ enum ImGuiTextFlags_
 {
     ImGuiTextFlags_None                         = 0,
     ImGuiTextFlags_NoWidthForLargeClippedText   = 1 << 0,
+    ImGuiTextFlags_LineCache                    = 1 << 1,   // Use/build a cached line index for large text. Text must be unchanged or only appended to between frames (see TextUnformattedAppendOnly()).
 };
 
 enum ImGuiTooltipFlags_
@@ -1207,6 +1386,32 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
     void    ClearFreeMemory()           { ID = 0; TextA.clear(); }
 };
 
+// Cached visual line index of a text buffer submitted to TextEx(), so only visible lines are measured/rendered.
+// - Large buffers submitted with ImGuiTextFlags_LineCache are keyed by pointer (ImGuiContext::TextLineCaches).
+// - Wrapped text (and inactive multi-line InputText() with word-wrapping) is keyed by contents and baked font (ImGuiContext::TextWrapCaches).
+// Validated every frame by comparing the buffer with a copy of the text laid out (a memcmp(), much cheaper than walking lines):
+// any modification is detected. Appending only lays out the new text, starting from the last line. Any other modification
+// lays out the whole text again. Changing the wrap width only needs a binary search per line (see ImFontWrapLayout).
+struct ImGuiTextLineCache
+{
+    ImGuiID             ID;                 // Hash of TextBegin pointer and ID scope, or of text contents and baked font (+ layout, when the same text is laid out twice in a frame)
+    const char*         TextBegin;
+    ImVector<char>      TextCopy;           // Copy of text laid out, to validate buffer contents
+    ImFont*             Font;               // Font used to measure lines. NULL when only splitting on '\n' without measuring widths.
+    float               FontSize;
+    float               WrapWidth;          // 0.0f when not wrapping
+    ImDrawTextFlags     WrapFlags;          // ImDrawTextFlags_WrapKeepBlanks for InputText()
+    float               WidthMax;           // Max width of all lines but the last one (which may be extended by appended text)
+    float               WidthLast;          // Width of last line
+    float               LastTimeActive;
+    int                 LastFrameActive;
+    ImGuiTextIndex      Lines;              // Start offset of each visual line (including wrapped lines)
+    ImFontWrapLayout    WrapLayout;         // When WrapWidth > 0.0f: break opportunities, to relayout at a different width without walking the text again
+
+    ImGuiTextLineCache() { memset(this, 0, sizeof(*this)); }
+    void ClearFreeMemory() { TextCopy.clear(); Lines.clear(); WrapLayout.ClearFreeMemory(); }
+};
+
 // Forward declare imstb_textedit.h structure + make its main configuration define accessible
 #undef IMSTB_TEXTEDIT_STRING
 #undef IMSTB_TEXTEDIT_CHARTYPE
@@ -1234,6 +1439,15 @@ struct IMGUI_API ImGuiInputTextState
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     int                     LineCount;              // last line count (solely for debugging)
+    ImGuiTextIndex          LineIndex;              // line index of TextA when multi-line, persistent and only rebuilt for paragraphs touched by edits
+    int                     LineIndexEditBegin;     // range modified since last LineIndex update: [LineIndexEditBegin, TextLen - LineIndexEditTail). INT_MAX when up to date.
+    int                     LineIndexEditTail;
+    int                     EditStreamBegin;        // range modified since last ImGuiInputTextFlags_CallbackEditStream event, same encoding as LineIndexEditBegin/LineIndexEditTail.
+    int                     EditStreamTail;
+    int                     EditStreamOldLen;       // TextLen before those modifications.
+    ImFont*                 LineIndexFont;          // font, size and wrapping width LineIndex was built for. NULL to request a full rebuild.
+    float                   LineIndexFontSize;
+    float                   LineIndexWrapWidth;
     float                   WrapWidth;              // word-wrapping width
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
     bool                    CursorFollow;           // set when we want scrolling to follow the current cursor position (not always!)
@@ -1247,8 +1461,9 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { OnTextEdited(0, TextLen); TextLen = 0; TextA[0] = 0; CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineIndex.clear(); LineIndexFont = NULL; }
+    void        OnTextEdited(int pos, int delete_len); // Must be called before TextLen is updated.
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
     float       GetPreferredOffsetX() const;
@@ -1536,6 +1751,7 @@ struct ImGuiInputEvent
     ImGuiInputEventType             Type;
     ImGuiInputSource                Source;
     ImU32                           EventId;        // Unique, sequential increasing integer to identify an event (if you need to correlate them to other data).
+    double                          Timestamp;      // Time of submission, in seconds (see ImTimeGetSeconds()). For coalesced events, time of the last merged submission.
     union
     {
         ImGuiInputEventMousePos     MousePos;       // if Type == ImGuiInputEventType_MousePos
@@ -1976,6 +2192,22 @@ struct ImGuiViewportP : public ImGuiViewport
     ImRect  GetBuildWorkRect() const    { ImVec2 pos = CalcWorkRectPos(BuildWorkInsetMin); ImVec2 size = CalcWorkRectSize(BuildWorkInsetMin, BuildWorkInsetMax); return ImRect(pos.x, pos.y, pos.x + size.x, pos.y + size.y); }
 };
 
+// Hashed uniform grid over windows' OuterRectClipped (+ padding), used by FindHoveredWindowEx() to only test windows near the queried position.
+// Windows are (re)registered in Begin() when their rectangle changes cells. The front-most match is selected using ImGuiWindow::DisplayIndex.
+struct ImGuiWindowHitGrid
+{
+    ImGuiStorage                        CellsMap;       // Map packed cell coordinates -> index into Cells[]
+    ImVector<ImVector<ImGuiWindow*> >   Cells;          // Windows overlapping each cell (unordered)
+    ImVector<ImGuiWindow*>              LargeWindows;   // Windows overlapping too many cells, always tested
+    ImVec2                              Padding;        // Padding applied to windows rectangles when registering (largest hit-testing padding). Grid is rebuilt when it changes.
+    int                                 EmptyCellsCount;// Number of Cells[] not overlapped by any window anymore. Removed by Compact().
+
+    ImGuiWindowHitGrid()                { CellsMap.SetHashIndex(true); Padding = ImVec2(0.0f, 0.0f); EmptyCellsCount = 0; }
+    ~ImGuiWindowHitGrid()               { Clear(); }
+    void Clear()                        { CellsMap.Clear(); Cells.clear_destruct(); LargeWindows.clear(); EmptyCellsCount = 0; }
+    void Compact();                     // Remove empty cells, release unused memory. Called by garbage collection in NewFrame().
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
@@ -1988,12 +2220,14 @@ struct ImGuiWindowSettings
     ImGuiID     ID;
     ImVec2ih    Pos;
     ImVec2ih    Size;
+    int         TextOffset;     // Offset of this entry's cached .ini text in g.SettingsWindowsText, -1 when it needs to be written again
+    int         TextSize;
     bool        Collapsed;
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
 
-    ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
+    ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); TextOffset = -1; }
     char* GetName()             { return (char*)(this + 1); }
 };
 
@@ -2007,11 +2241,17 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* data, size_t data_size);  // Read: Optional. Called with the payload written by WriteAllBinaryFn (binary .ini data)
+    void        (*WriteAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf); // Write: Optional. Output every entries into 'out_buf' as binary data when io.IniSavingBinary is set, otherwise WriteAllFn's text is stored.
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Helpers for handlers reading/writing binary .ini data (native endianness, no alignment requirement)
+template<typename T> static inline void ImSettingsBinaryWrite(ImGuiTextBuffer* buf, const T& v)           { buf->append((const char*)&v, (const char*)&v + sizeof(T)); }
+template<typename T> static inline bool ImSettingsBinaryRead(const char** p, const char* p_end, T* out)   { if ((size_t)(p_end - *p) < sizeof(T)) return false; memcpy(out, *p, sizeof(T)); *p += sizeof(T); return true; }
+
 //-----------------------------------------------------------------------------
 // [SECTION] Localization support
 //-----------------------------------------------------------------------------
@@ -2098,6 +2338,65 @@ struct ImGuiDebugAllocInfo
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+struct ImGuiDebugHashInfo
+{
+    int         HashCount;                  // Number of hashes computed by GetID() functions in current frame.
+    int         HashCountLastFrame;         // Number of hashes computed by GetID() functions in previous frame.
+    float       MeasuredBytesPerSec;        // Result of last throughput measurement in Metrics/Debugger window (0.0f if never measured).
+    float       MeasuredSecPerHash;         // "
+
+    ImGuiDebugHashInfo() { memset(this, 0, sizeof(*this)); }
+};
+
+// Storage for the built-in CPU profiler (see IMGUI_ENABLE_PROFILER in imconfig.h, 'Metrics->Profiler', ProfilerSaveChromeTrace())
+// - Zones are submitted with IMGUI_PROFILER_SCOPE() or IMGUI_PROFILER_ZONE_BEGIN()/IMGUI_PROFILER_ZONE_END(), which are compiled out by default.
+// - Within a frame, calls to a same zone under a same parent are merged (Count, TotalTime), so e.g. thousands of RenderText() calls only take one zone.
+// - Completed frames and their zones are stored in ring buffers: oldest frames are discarded when full, nothing is allocated after warm-up.
+struct ImGuiProfilerZone
+{
+    ImGuiID             ID;                 // Hash of name pointer, seeded with parent zone ID
+    int                 NameOffset;         // Offset into ImGuiProfiler::NamesBuf
+    int                 ParentIdx;          // Index of parent zone in same frame, -1 for root zones. Parents are always stored before their children.
+    int                 Depth;
+    int                 Count;              // Number of merged calls
+    double              StartTime;          // Start time of first call
+    double              TotalTime;          // Sum of all calls durations
+};
+
+struct ImGuiProfilerFrame
+{
+    int                 FrameCount;
+    double              StartTime;
+    double              EndTime;
+    ImS64               ZonesIdx;           // Absolute index of first zone (see ImGuiProfiler::ZonesTotalCount)
+    int                 ZonesCount;
+};
+
+struct ImGuiProfiler
+{
+    bool                Enabled;            // Record frames. Changes are applied on next NewFrame().
+    bool                Active;             // Recording current frame.
+    bool                FrameOpened;
+    bool                ClearRequest;       // Clear recorded frames on next NewFrame().
+    int                 FramesCapacity;     // = 300
+    int                 ZonesCapacity;      // = 32*1024
+    ImGuiProfilerFrame  CurrFrame;
+    ImVector<ImGuiProfilerZone> CurrZones;
+    ImVector<int>       CurrStack;          // Open zones, index into CurrZones
+    ImVector<double>    CurrStackTimes;     // Start time of open zones current call
+    ImGuiStorage        CurrZonesMap;       // Zone ID -> index into CurrZones
+    ImRingBuffer<ImGuiProfilerFrame> Frames;
+    ImRingBuffer<ImGuiProfilerZone>  Zones;
+    ImS64               ZonesTotalCount;    // Number of zones ever stored into Zones
+    ImGuiTextBuffer     NamesBuf;           // Zone names are copied, as e.g. window names storage may be reallocated
+    ImGuiStorage        NamesMap;           // Name hash -> offset into NamesBuf
+    int                 NamesBufCompactSize;// Compact NamesBuf when it grows larger than this
+
+    ImGuiProfiler()     { Enabled = Active = FrameOpened = ClearRequest = false; FramesCapacity = 300; ZonesCapacity = 32 * 1024; memset(&CurrFrame, 0, sizeof(CurrFrame)); ZonesTotalCount = 0; NamesBufCompactSize = 64 * 1024; }
+    ImGuiProfilerZone&  GetFrameZone(const ImGuiProfilerFrame* frame, int n) { return Zones[(int)(frame->ZonesIdx - (ZonesTotalCount - Zones.Size)) + n]; }
+    const char*         GetZoneName(const ImGuiProfilerZone* zone) const     { return NamesBuf.c_str() + zone->NameOffset; }
+};
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2114,6 +2413,7 @@ struct ImGuiMetricsConfig
     int         HighlightMonitorIdx = -1;
     ImGuiID     HighlightViewportID = 0;
     bool        ShowFontPreview = true;
+    int         ProfilerSelectedFrame = 0;      // Offset from last recorded frame
 };
 
 struct ImGuiStackLevelInfo
@@ -2188,6 +2488,7 @@ struct ImGuiContext
     ImGuiPlatformIO         PlatformIO;
     ImGuiStyle              Style;
     ImVector<ImFontAtlas*>  FontAtlases;                        // List of font atlases used by the context (generally only contains g.IO.Fonts aka the main font atlas)
+    ImVector<ImFontAtlas*>  FontAtlasesLocked;                  // Thread-shared font atlases on which we hold a read lock, from NewFrame() to next NewFrame() or UnlockFontAtlases().
     ImFont*                 Font;                               // Currently bound font. (== FontStack.back().Font)
     ImFontBaked*            FontBaked;                          // Currently bound font at currently bound size. (== Font->GetFontBaked(FontSize))
     float                   FontSize;                           // Currently bound font size == line height (== FontSizeBase + externals scales applied in the UpdateCurrentFontSize() function).
@@ -2200,8 +2501,10 @@ struct ImGuiContext
     void*                   TestEngine;                         // Test engine user data
 
     // Inputs
-    ImVector<ImGuiInputEvent> InputEventsQueue;                 // Input events which will be trickled/written into IO structure.
+    ImRingBuffer<ImGuiInputEvent> InputEventsQueue;             // Input events which will be trickled/written into IO structure.
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
+    ImRingBuffer<ImGuiMousePosSample> InputMouseSamplesQueue;   // Raw mouse position samples, waiting for their input event to be processed. Fixed capacity: oldest samples are discarded.
+    ImVector<ImGuiMousePosSample> InputMouseSamples;            // Raw mouse position samples processed in NewFrame(). See GetMousePosSamples().
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
 
@@ -2209,6 +2512,8 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    bool                    WindowsDisplayIndexDirty;           // Set when Windows[] order changed: ImGuiWindow::DisplayIndex needs to be refreshed
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index of windows OuterRectClipped, for FindHoveredWindowEx()
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -2438,6 +2743,8 @@ struct ImGuiContext
     // Widget state
     ImGuiInputTextState     InputTextState;
     ImGuiTextIndex          InputTextLineIndex;                 // Temporary storage
+    ImPool<ImGuiTextLineCache> TextLineCaches;                  // Line index of large text buffers submitted to TextUnformattedAppendOnly(), keyed by buffer pointer
+    ImVector<ImGuiTextLineCache> TextWrapCaches;                // Line index of wrapped text, keyed by contents and baked font. 4-way set-associative table, entries are recycled.
     ImGuiInputTextDeactivatedState InputTextDeactivatedState;
     ImFontBaked             InputTextPasswordFontBackupBaked;
     ImFontFlags             InputTextPasswordFontBackupFlags;
@@ -2486,6 +2793,10 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsIndex;   // Map ID -> offset into SettingsWindows[] (of last created or revived entry: may point to a WantDelete entry)
+    ImGuiStorage                        SettingsTablesIndex;    // Map ID -> offset into SettingsTables[] (of last created entry: may point to an invalidated entry with ID==0)
+    ImGuiTextBuffer                     SettingsWindowsText;    // Cached .ini text of SettingsWindows[] entries, so saving only needs to write modified entries again
+    ImGuiTextBuffer                     SettingsTablesText;     // Cached .ini text of SettingsTables[] entries
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2528,6 +2839,11 @@ struct ImGuiContext
     bool                    DebugBreakInLocateId;               // Debug break in ItemAdd() call for g.DebugLocateId.
     ImGuiKeyChord           DebugBreakKeyChord;                 // = ImGuiKey_Pause
     ImS8                    DebugBeginReturnValueCullDepth;     // Cycle between 0..9 then wrap around.
+    bool                    DebugNavScoringNoCull;              // Score every nav candidate, disabling NavScoreItemIsCulled(). Results must be identical (see tests/test_nav_scoring.cpp).
+    bool                    DebugInputTextLineIndexCheck;       // Compare incrementally updated line index of active multi-line InputText() with a full rebuild every frame (see tests/test_input_text_line_index.cpp).
+    int                     DebugInputTextLineIndexErrors;      // Number of mismatches found with DebugInputTextLineIndexCheck.
+    bool                    DebugTextLineCacheCheck;            // Compare sizes/line indices of wrapped text computed from ImGuiTextLineCache with a walk over the whole text every frame (see tests/test_text_line_cache.cpp).
+    int                     DebugTextLineCacheErrors;           // Number of mismatches found with DebugTextLineCacheCheck.
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImU8                    DebugItemPickerMouseButton;
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
@@ -2537,6 +2853,8 @@ struct ImGuiContext
     ImGuiDebugItemPathQuery DebugItemPathQuery;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImGuiDebugHashInfo      DebugHashInfo;
+    ImGuiProfiler           Profiler;                           // Built-in CPU profiler, zones are only submitted when compiled with IMGUI_ENABLE_PROFILER
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2670,6 +2988,8 @@ struct IMGUI_API ImGuiWindow
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
     short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    int                     DisplayIndex;                       // Index within g.Windows[] (display order). Refreshed lazily: see g.WindowsDisplayIndexDirty.
+    ImVec2ih                HitGridCellMin, HitGridCellMax;     // Range of cells this window is registered in, within g.WindowsHitGrid. Empty (Min > Max) if not registered.
     ImGuiDir                AutoPosLastDirection;
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
@@ -3113,11 +3433,13 @@ struct ImGuiTableSettings
     ImGuiID                     ID;                     // Set to 0 to invalidate/delete the setting
     ImGuiTableFlags             SaveFlags;              // Indicate data we want to save using the Resizable/Reorderable/Sortable/Hideable flags (could be using its own flags..)
     float                       RefScale;               // Reference scale to be able to rescale columns on font/dpi changes.
+    int                         TextOffset;             // Offset of this entry's cached .ini text in g.SettingsTablesText, -1 when it needs to be written again
+    int                         TextSize;
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
 
-    ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
+    ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); TextOffset = -1; }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
 };
 
@@ -3175,7 +3497,8 @@ namespace ImGui
     IMGUI_API void          RegisterUserTexture(ImTextureData* tex); // Register external texture. EXPERIMENTAL: DO NOT USE YET.
     IMGUI_API void          UnregisterUserTexture(ImTextureData* tex);
     IMGUI_API void          RegisterFontAtlas(ImFontAtlas* atlas);
-    IMGUI_API void          UnregisterFontAtlas(ImFontAtlas* atlas);
+    IMGUI_API int           UnregisterFontAtlas(ImFontAtlas* atlas);   // Return number of contexts still using the atlas
+    IMGUI_API void          UnlockFontAtlases();                        // Release read locks on thread-shared atlases held since NewFrame(). Call after rendering draw data, otherwise done by next NewFrame().
     IMGUI_API void          SetCurrentFont(ImFont* font, float font_size_before_scaling, float font_size_after_scaling);
     IMGUI_API void          UpdateCurrentFontSize(float restore_font_size_after_scaling);
     IMGUI_API void          SetFontRasterizerDensity(float rasterizer_density);
@@ -3671,6 +3994,7 @@ namespace ImGui
 
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
+    IMGUI_API void          GcCompactWindowSettings();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
 
@@ -3713,6 +4037,7 @@ namespace ImGui
     IMGUI_API void          DebugNodeInputTextState(ImGuiInputTextState* state);
     IMGUI_API void          DebugNodeTypingSelectState(ImGuiTypingSelectState* state);
     IMGUI_API void          DebugNodeMultiSelectState(ImGuiMultiSelectState* state);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
     IMGUI_API void          DebugNodeWindow(ImGuiWindow* window, const char* label);
     IMGUI_API void          DebugNodeWindowSettings(ImGuiWindowSettings* settings);
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
@@ -3721,6 +4046,15 @@ namespace ImGui
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Profiler (zones are compiled out unless IMGUI_ENABLE_PROFILER is defined, see IMGUI_PROFILER_SCOPE() etc.)
+    IMGUI_API void          ProfilerFrameBegin();
+    IMGUI_API void          ProfilerFrameEnd();
+    IMGUI_API void          ProfilerZoneBegin(const char* name);
+    IMGUI_API void          ProfilerZoneEnd();
+    IMGUI_API void          ProfilerClear();                                        // Clear recorded frames on next NewFrame()
+    IMGUI_API void          ProfilerExportChromeTrace(ImGuiTextBuffer* out_buf);    // Export recorded frames in Chrome Trace Event JSON format (chrome://tracing, https://ui.perfetto.dev)
+    IMGUI_API bool          ProfilerSaveChromeTrace(const char* filename);
+
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     //inline void   SetItemUsingMouseWheel()                                            { SetItemKeyOwner(ImGuiKey_MouseWheelY); }      // Changed in 1.89
@@ -3766,6 +4100,7 @@ struct ImFontLoader
 
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 IMGUI_API const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype();
+IMGUI_API void              ImFontAtlasStbTrueTypeGetCmapCacheInfo(ImFontConfig* src, int* out_size_in_bytes, int* out_pages_count); // For Metrics window
 #endif
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are not actually compatible but we provide this as a compile-time error report helper.
@@ -3775,6 +4110,7 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 // [SECTION] ImFontAtlas internal API
 //-----------------------------------------------------------------------------
 
+#define IMGUI_FONT_SIZE_DEFAULT                                 (20.0f)     // Default font size if unspecified in both style.FontSizeBase and AddFontXXX() calls.
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
 
@@ -3803,6 +4139,17 @@ struct ImFontAtlasRectEntry
     unsigned int        IsUsed : 1;
 };
 
+// Read-only font data shared by font sources of multiple atlases/contexts (see ImGui::CreateFontSharedDataFromFile())
+// - Data is never written to after creation, so loaders may read it concurrently from multiple threads.
+// - RefCount is modified with atomic operations, as atlases owned by different contexts may be released from different threads.
+struct ImFontSharedData
+{
+    void*               Data;
+    int                 DataSize;
+    bool                IsMapped;               // Data is a file mapping (see ImFileMap()), otherwise it was allocated with IM_ALLOC().
+    volatile int        RefCount;
+};
+
 // Data available to potential texture post-processing functions
 struct ImFontAtlasPostProcessData
 {
@@ -3820,22 +4167,47 @@ struct ImFontAtlasPostProcessData
     int                 Height;
 };
 
-// We avoid dragging imstb_rectpack.h into public header (partly because binding generators are having issues with it)
-#ifdef IMGUI_STB_NAMESPACE
-namespace IMGUI_STB_NAMESPACE { struct stbrp_node; }
-typedef IMGUI_STB_NAMESPACE::stbrp_node stbrp_node_im;
-#else
-struct stbrp_node;
-typedef stbrp_node stbrp_node_im;
-#endif
-struct stbrp_context_opaque { char data[80]; };
+// Texture page of a ImFontAtlas. Page 0 is always atlas->TexData, other pages are only used when atlas->TexPageWidth/TexPageHeight are set.
+#define IM_FONTATLAS_MAX_PAGES      32                  // Limited by ImFontGlyph::PageIdx bit-field
+struct ImFontAtlasPage
+{
+    ImTextureData*              TexData;                // Page texture. NULL for page 0: use atlas->TexData which may change on resize/repack.
+    ImVector<ImTextureRect>     PackFreeRects;          // Free rectangles, including padding. May overlap each other, but never contain each other.
+    bool                        PackFreeRectsDirty;     // Set when a rectangle was freed: PackFreeRects[] may not be maximal anymore.
+    int                         RectsPackedSurface;     // Number of packed pixels in this page, including padding (builder->RectsPackedSurface is the sum for all pages).
+    int                         RectsDiscardedSurface;  // Number of discarded pixels in this page.
+
+    ImFontAtlasPage()           { TexData = NULL; PackFreeRectsDirty = false; RectsPackedSurface = RectsDiscardedSurface = 0; }
+    int                         GetUsedSurface() const  { return RectsPackedSurface - RectsDiscardedSurface; }
+};
+
+// Glyph or font size missed by a context using a thread-shared atlas (ImFontAtlasFlags_ThreadShared), to bake on next ImFontAtlasUpdateNewFrame().
+struct ImFontAtlasSharedRequest
+{
+    ImFont*                     Font;
+    float                       Size;
+    float                       RasterizerDensity;
+    unsigned int                Codepoint;              // 0 when only requesting a size
+};
+
+// Glyph which may be moved by ImFontAtlasPackDefragStep()
+struct ImFontAtlasDefragCandidate
+{
+    ImFontGlyph*                Glyph;
+    int                         Bottom;
+};
 
 // Internal storage for incrementally packing and building a ImFontAtlas
+// - Packing uses a free-rectangles list (MaxRects): free space is tracked as a list of maximal, possibly overlapping, rectangles.
+//   Discarded rectangles are returned to that list and reused, so we don't need a full repack to recover their space.
+// - Incremental defragmentation (see ImFontAtlasPackDefragStep()) moves a few glyphs per frame toward the top of the texture,
+//   within a pixel copy budget, so free space coalesces and a full stop-the-world repack is rarely needed.
 struct ImFontAtlasBuilder
 {
-    stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
-    ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImFontAtlasPage>   Pages;                  // Texture pages. Pages[0] always exists.
+    ImVector<ImTextureRect>     PackFreeRectsNew;       // Scratch buffer used when splitting free rectangles
     ImVector<ImTextureRect>     Rects;
+    ImVector<ImU8>              RectsPageIdx;           // Page index for each entry of Rects[]
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
     int                         RectsIndexFreeListStart;// First unused entry
@@ -3843,6 +4215,16 @@ struct ImFontAtlasBuilder
     int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
     int                         RectsDiscardedCount;
     int                         RectsDiscardedSurface;
+    int                         RepackCount;            // Number of full repacks (stop-the-world copy of every rectangle into a new texture).
+    int                         DefragPixelBudget;      // Maximum number of pixels copied per frame by incremental defragmentation. 0 to disable.
+    float                       DefragThreshold;        // Run incremental defragmentation when fragmentation (see ImFontAtlasPackGetFragmentation()) is over this value.
+    int                         DefragMovedCount;       // Number of rectangles moved by incremental defragmentation.
+    int                         DefragMovedSurface;     // Number of pixels copied by incremental defragmentation.
+    bool                        DefragIdle;             // Set when last defragmentation step couldn't move anything. Cleared when a rectangle is discarded.
+    ImVector<ImFontAtlasDefragCandidate> DefragCandidates; // Scratch buffer for ImFontAtlasPackDefragStep(), reused across frames.
+    ImVector<ImFontAtlasEvictEntry> EvictCandidates;    // Scratch buffer for ImFontAtlasBuildEvictGlyphs(), reused across frames.
+    int                         GlyphsEvictedCount;     // Number of glyphs evicted to stay within atlas->MemoryBudget.
+    int                         BakedEvictedCount;      // Number of baked fonts discarded to stay within atlas->MemoryBudget.
     int                         FrameCount;             // Current frame count
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
@@ -3854,11 +4236,18 @@ struct ImFontAtlasBuilder
     ImGuiStorage                BakedMap;               // BakedId --> ImFontBaked*
     int                         BakedDiscardedCount;
 
+    // Thread-shared atlas (ImFontAtlasFlags_ThreadShared)
+    int                         SharedLockState;        // Number of read locks held, or -1 when locked for writing. See ImFontAtlasLockShared()/ImFontAtlasLockExclusive().
+    int                         SharedLockWritersWaiting; // New read locks wait until no writer is waiting.
+    int                         SharedRequestsLock;     // Spin lock protecting SharedRequests[], SharedRequestsMap and font sources lookups made by readers.
+    ImVector<ImFontAtlasSharedRequest> SharedRequests;  // Requests made by readers, baked by next ImFontAtlasUpdateNewFrame().
+    ImGuiStorage                SharedRequestsMap;      // Request hash --> 1, to ignore duplicate requests.
+
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
-    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
+    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; DefragPixelBudget = 64 * 64 * 16; DefragThreshold = 0.50f; }
 };
 
 IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
@@ -3875,15 +4264,21 @@ IMGUI_API void              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_w = -1, int old_h = -1);
 IMGUI_API void              ImFontAtlasTextureCompact(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasTextureUsePages(ImFontAtlas* atlas);
+IMGUI_API int               ImFontAtlasTextureAddPage(ImFontAtlas* atlas, ImTextureFormat format);
 IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
+IMGUI_API int               ImFontAtlasBuildEvictGlyphs(ImFontAtlas* atlas, int surface_to_free, int unused_frames);
+IMGUI_API void              ImFontAtlasBuildUpdateMemoryBudget(ImFontAtlas* atlas);
+IMGUI_API int               ImFontAtlasBuildGetResidentBytes(ImFontAtlas* atlas, int* out_tex_bytes = NULL, int* out_baked_bytes = NULL);
 
 IMGUI_API bool              ImFontAtlasFontSourceInit(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
+IMGUI_API int               ImFontAtlasFontResolveSource(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint); // Return index in font->Sources[] of first source providing the (remapped) code-point, -1 if none.
 IMGUI_API void              ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API bool              ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font); // Using FontDestroyOutput/FontInitOutput sequence useful notably if font loader params have changed
 IMGUI_API void              ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font);
@@ -3897,15 +4292,27 @@ IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont*
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
+IMGUI_API int               ImFontAtlasBakedEvictFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyph);
+IMGUI_API int               ImFontAtlasBakedGetMemoryUsage(ImFontBaked* baked);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
-IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL, bool allow_any_page = false, bool want_colors = false);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API int               ImFontAtlasPackGetRectPageIdx(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPackGetPageTexture(ImFontAtlas* atlas, int page_idx);
+IMGUI_API ImTextureRef      ImFontAtlasPackGetPageTexRef(ImFontAtlas* atlas, int page_idx);
+IMGUI_API float             ImFontAtlasPackGetFragmentation(ImFontAtlas* atlas, int* out_free_surface = NULL, int* out_largest_free_surface = NULL);
+IMGUI_API int               ImFontAtlasPackDefragStep(ImFontAtlas* atlas, int pixel_budget);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
+IMGUI_API void              ImFontAtlasLockShared(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasUnlockShared(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasLockExclusive(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasUnlockExclusive(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasIsSharedReadOnly(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
@@ -3928,6 +4335,31 @@ IMGUI_API void              ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atla
 
 IMGUI_API bool      ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor cursor_type, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2]);
 
+//-----------------------------------------------------------------------------
+// [SECTION] Profiler zones (IMGUI_ENABLE_PROFILER)
+//-----------------------------------------------------------------------------
+
+// Zone names must be string literals or any string valid until the end of the zone: names are hashed by pointer, then copied once per frame.
+// IMGUI_PROFILER_FRAME_BEGIN()/IMGUI_PROFILER_FRAME_END() are called by NewFrame()/Render(). Zones submitted outside of a frame are ignored.
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name)    { ImGui::ProfilerZoneBegin(name); }
+    ~ImGuiProfilerScope()                   { ImGui::ProfilerZoneEnd(); }
+};
+#define IMGUI_PROFILER_FRAME_BEGIN()        ImGui::ProfilerFrameBegin()
+#define IMGUI_PROFILER_FRAME_END()          ImGui::ProfilerFrameEnd()
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME)    ImGui::ProfilerZoneBegin(_NAME)
+#define IMGUI_PROFILER_ZONE_END()           ImGui::ProfilerZoneEnd()
+#define IMGUI_PROFILER_SCOPE(_NAME)         ImGuiProfilerScope im_profiler_scope(_NAME)  // One per scope
+#else
+#define IMGUI_PROFILER_FRAME_BEGIN()        ((void)0)
+#define IMGUI_PROFILER_FRAME_END()          ((void)0)
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME)    ((void)0)
+#define IMGUI_PROFILER_ZONE_END()           ((void)0)
+#define IMGUI_PROFILER_SCOPE(_NAME)         ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
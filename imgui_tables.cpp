@@ -804,6 +804,7 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout");
     IM_ASSERT(table->IsLayoutLocked == false);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
@@ -3632,6 +3633,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteAllBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3663,18 +3666,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesIndex.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
+// A new entry is only created after invalidating the previous one for this ID (if any), so the indexed entry is the only candidate.
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesIndex.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3752,6 +3757,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->TextOffset = -1; // Cached text needs to be written again
 
     MarkIniSettingsDirty();
 }
@@ -3834,6 +3840,8 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesIndex.Clear();
+    g.SettingsTablesText.resize(0);
 }
 
 // Apply to existing windows (if any)
@@ -3848,13 +3856,8 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static ImGuiTableSettings* TableSettingsHandler_ReadOpenByID(ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3867,6 +3870,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsHandler_ReadOpenByID(id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3895,41 +3907,127 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Each entry's text is cached in g.SettingsTablesText, only new or modified entries are formatted again (see TableSaveSettings()).
     ImGuiContext& g = *ctx;
+    ImGuiTextBuffer* text_cache = &g.SettingsTablesText;
+    int text_live_size = 0;
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
 
-        // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
-        // (e.g. Order was unchanged)
-        const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
-        const bool save_visible = (settings->SaveFlags & ImGuiTableFlags_Hideable) != 0;
-        const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
-        const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
-        // We need to save the [Table] entry even if all the bools are false, since this records a table with "default settings".
-
-        buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
-        buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
-        if (settings->RefScale != 0.0f)
-            buf->appendf("RefScale=%g\n", settings->RefScale);
+        if (settings->TextOffset == -1)
+        {
+            // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
+            // (e.g. Order was unchanged)
+            const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
+            const bool save_visible = (settings->SaveFlags & ImGuiTableFlags_Hideable) != 0;
+            const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
+            const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
+            // We need to save the [Table] entry even if all the bools are false, since this records a table with "default settings".
+
+            settings->TextOffset = text_cache->size();
+            text_cache->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
+            if (settings->RefScale != 0.0f)
+                text_cache->appendf("RefScale=%g\n", settings->RefScale);
+            ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+            for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+            {
+                // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
+                bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
+                if (!save_column)
+                    continue;
+                text_cache->appendf("Column %-2d", column_n);
+                if (column->UserID != 0)                    { text_cache->appendf(" UserID=%08X", column->UserID); }
+                if (save_size && column->IsStretch)         { text_cache->appendf(" Weight=%.4f", column->WidthOrWeight); }
+                if (save_size && !column->IsStretch)        { text_cache->appendf(" Width=%d", (int)column->WidthOrWeight); }
+                if (save_visible)                           { text_cache->appendf(" Visible=%d", column->IsEnabled); }
+                if (save_order)                             { text_cache->appendf(" Order=%d", column->DisplayOrder); }
+                if (save_sort && column->SortOrder != -1)   { text_cache->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
+                text_cache->append("\n");
+            }
+            text_cache->append("\n");
+            settings->TextSize = text_cache->size() - settings->TextOffset;
+        }
+        const char* text = text_cache->begin() + settings->TextOffset;
+        buf->append(text, text + settings->TextSize);
+        text_live_size += settings->TextSize;
+    }
+
+    // Discard cached text once stale text outweighs live text. Entries will be formatted again on next save.
+    if (text_cache->size() > text_live_size * 2 + 4096)
+    {
+        text_cache->resize(0);
+        for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+            settings->TextOffset = -1;
+    }
+}
+
+// Binary entry: ImGuiID ID, ImS16 ColumnsCount, ImS32 SaveFlags, float RefScale, then for each column:
+// float WidthOrWeight, ImGuiID UserID, ImS16 Index, ImS16 DisplayOrder, ImS16 SortOrder, ImU8 SortDirection, ImS8 IsEnabled, ImU8 IsStretch
+static void TableSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const char* data, size_t data_size)
+{
+    const char* data_end = data + data_size;
+    ImGuiID id;
+    ImS16 columns_count;
+    ImS32 save_flags;
+    float ref_scale;
+    while (ImSettingsBinaryRead(&data, data_end, &id) && ImSettingsBinaryRead(&data, data_end, &columns_count) && ImSettingsBinaryRead(&data, data_end, &save_flags) && ImSettingsBinaryRead(&data, data_end, &ref_scale))
+    {
+        const size_t column_size = sizeof(float) + sizeof(ImGuiID) + sizeof(ImS16) * 3 + sizeof(ImU8) * 3;
+        if (id == 0 || columns_count < 0 || (size_t)(data_end - data) < column_size * columns_count)
+            break;
+        ImGuiTableSettings* settings = TableSettingsHandler_ReadOpenByID(id, columns_count);
+        settings->SaveFlags = save_flags;
+        settings->RefScale = ref_scale;
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < columns_count; column_n++, column++)
+        {
+            ImS16 index = 0, display_order = 0, sort_order = 0;
+            ImU8 sort_direction = 0, is_stretch = 0;
+            ImS8 is_enabled = 1;
+            ImSettingsBinaryRead(&data, data_end, &column->WidthOrWeight);
+            ImSettingsBinaryRead(&data, data_end, &column->UserID);
+            ImSettingsBinaryRead(&data, data_end, &index);
+            ImSettingsBinaryRead(&data, data_end, &display_order);
+            ImSettingsBinaryRead(&data, data_end, &sort_order);
+            ImSettingsBinaryRead(&data, data_end, &sort_direction);
+            ImSettingsBinaryRead(&data, data_end, &is_enabled);
+            ImSettingsBinaryRead(&data, data_end, &is_stretch);
+            column->Index = (ImGuiTableColumnIdx)index;
+            column->DisplayOrder = (ImGuiTableColumnIdx)display_order;
+            column->SortOrder = (ImGuiTableColumnIdx)sort_order;
+            column->SortDirection = sort_direction;
+            column->IsEnabled = is_enabled;
+            column->IsStretch = is_stretch;
+        }
+    }
+}
+
+static void TableSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    buf->reserve(buf->size() + g.SettingsTables.size()); // ballpark reserve
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        ImSettingsBinaryWrite(buf, settings->ID);
+        ImSettingsBinaryWrite(buf, (ImS16)settings->ColumnsCount);
+        ImSettingsBinaryWrite(buf, (ImS32)settings->SaveFlags);
+        ImSettingsBinaryWrite(buf, settings->RefScale);
         ImGuiTableColumnSettings* column = settings->GetColumnSettings();
         for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
         {
-            // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
-            bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
-            if (!save_column)
-                continue;
-            buf->appendf("Column %-2d", column_n);
-            if (column->UserID != 0)                    { buf->appendf(" UserID=%08X", column->UserID); }
-            if (save_size && column->IsStretch)         { buf->appendf(" Weight=%.4f", column->WidthOrWeight); }
-            if (save_size && !column->IsStretch)        { buf->appendf(" Width=%d", (int)column->WidthOrWeight); }
-            if (save_visible)                           { buf->appendf(" Visible=%d", column->IsEnabled); }
-            if (save_order)                             { buf->appendf(" Order=%d", column->DisplayOrder); }
-            if (save_sort && column->SortOrder != -1)   { buf->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
-            buf->append("\n");
+            ImSettingsBinaryWrite(buf, column->WidthOrWeight);
+            ImSettingsBinaryWrite(buf, column->UserID);
+            ImSettingsBinaryWrite(buf, (ImS16)column->Index);
+            ImSettingsBinaryWrite(buf, (ImS16)column->DisplayOrder);
+            ImSettingsBinaryWrite(buf, (ImS16)column->SortOrder);
+            ImSettingsBinaryWrite(buf, (ImU8)column->SortDirection);
+            ImSettingsBinaryWrite(buf, (ImS8)column->IsEnabled);
+            ImSettingsBinaryWrite(buf, (ImU8)column->IsStretch);
         }
-        buf->append("\n");
     }
 }
 
@@ -3943,6 +4041,8 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteAllBinaryFn = TableSettingsHandler_WriteAllBinary;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3995,14 +4095,31 @@ void ImGui::TableGcCompactSettings()
     int required_memory = 0;
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
         if (settings->ID != 0)
-            required_memory += (int)TableSettingsCalcChunkSize(settings->ColumnsCount);
+            required_memory += g.SettingsTables.chunk_size(settings);
     if (required_memory == g.SettingsTables.Buf.Size)
         return;
+
+    // Tables bound to an invalidated entry will search again or create a new one when needed.
+    for (int i = 0; i != g.Tables.GetMapSize(); i++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
+            if (table->SettingsOffset != -1 && g.SettingsTables.ptr_from_offset(table->SettingsOffset)->ID == 0)
+                table->SettingsOffset = -1;
+
     ImChunkStream<ImGuiTableSettings> new_chunk_stream;
     new_chunk_stream.Buf.reserve(required_memory);
+    g.SettingsTablesIndex.Clear();
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
         if (settings->ID != 0)
-            memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
+        {
+            const int chunk_data_size = g.SettingsTables.chunk_size(settings) - 4; // Preserve ColumnsCountMax capacity of recycled entries
+            ImGuiTableSettings* new_settings = new_chunk_stream.alloc_chunk((size_t)chunk_data_size);
+            memcpy(new_settings, settings, (size_t)chunk_data_size);
+            g.SettingsTablesIndex.SetInt(new_settings->ID, new_chunk_stream.offset_from_ptr(new_settings));
+        }
+    for (int i = 0; i != g.Tables.GetMapSize(); i++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
+            if (table->SettingsOffset != -1)
+                table->SettingsOffset = g.SettingsTablesIndex.GetInt(table->ID, -1);
     g.SettingsTables.swap(new_chunk_stream);
 }
 
@@ -142,6 +142,7 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 //-------------------------------------------------------------------------
 // - TextEx() [Internal]
 // - TextUnformatted()
+// - TextUnformattedAppendOnly()
 // - Text()
 // - TextV()
 // - TextColored()
@@ -156,6 +157,200 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 // - BulletTextV()
 //-------------------------------------------------------------------------
 
+// Update line index of a text buffer.
+// - With font == NULL we only split on '\n' and don't measure widths, which is only a memchr() pass.
+// - Otherwise each visual line is measured so count/widths match CalcTextSize(). When wrapping, a ImFontWrapLayout
+//   is kept so a change of wrap width (e.g. resizing window) only needs a binary search per line.
+// - Text is compared with a copy of the text laid out: appended text is laid out starting from the last line.
+static void TextLineCacheUpdate(ImGuiTextLineCache* cache, ImGuiID id, const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width, ImDrawTextFlags wrap_flags)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    cache->TextBegin = text;
+    cache->LastTimeActive = (float)g.Time;
+    cache->LastFrameActive = g.FrameCount;
+
+    // Validate previous contents
+    const int cached_len = cache->TextCopy.Size;
+    bool rebuild = (cache->ID != id || cache->Font != font || cached_len > text_len || (font != NULL && cache->FontSize != font_size));
+    if (!rebuild)
+        rebuild = (memcmp(cache->TextCopy.Data, text, (size_t)cached_len) != 0);
+    const bool relayout = rebuild || (font != NULL && (cache->WrapWidth != wrap_width || cache->WrapFlags != wrap_flags));
+    if (!relayout && cached_len == text_len)
+        return;
+
+    // Keep allocated memory, as entries of TextWrapCaches are recycled
+    if (rebuild)
+    {
+        cache->ID = id;
+        cache->TextCopy.resize(0);
+        cache->Font = font;
+        cache->FontSize = font_size;
+        cache->WrapLayout.Clear();
+    }
+    if (relayout)
+    {
+        cache->WrapWidth = wrap_width;
+        cache->WrapFlags = wrap_flags;
+        cache->WidthMax = cache->WidthLast = 0.0f;
+        cache->Lines.Offsets.resize(0);
+        cache->Lines.EndOffset = 0;
+    }
+
+    if (font == NULL)
+    {
+        cache->Lines.append(text, cache->TextCopy.Size, text_len);
+    }
+    else
+    {
+        ImFontWrapLayout* wrap_layout = (wrap_width > 0.0f) ? &cache->WrapLayout : NULL;
+        if (wrap_layout)
+            wrap_layout->Build(font, font_size, text, text_end);
+
+        // Resume from start of last line, which may be extended by appended text
+        ImVector<int>& offsets = cache->Lines.Offsets;
+        const char* s = text;
+        if (offsets.Size > 0)
+        {
+            s = text + offsets.back();
+            offsets.pop_back();
+        }
+        cache->WidthLast = 0.0f;
+        if (wrap_layout)
+        {
+            // Same as the loop below, using the wrap layout (ImTextCalcWordWrapNextLineStart() skips blanks unless ImDrawTextFlags_WrapKeepBlanks, and one '\n')
+            for (int line_offset = (int)(s - text); line_offset < text_len; )
+            {
+                offsets.push_back(line_offset);
+                const int wrap_offset = wrap_layout->CalcWordWrapPosition(text, line_offset, wrap_width, wrap_flags);
+                cache->WidthMax = ImMax(cache->WidthMax, cache->WidthLast);
+                cache->WidthLast = wrap_layout->CalcTextWidth(text, line_offset, wrap_offset);
+                line_offset = (wrap_offset < text_len) ? (int)(ImTextCalcWordWrapNextLineStart(text + wrap_offset, text_end, wrap_flags) - text) : text_len;
+            }
+        }
+        else
+        {
+            while (s < text_end)
+            {
+                offsets.push_back((int)(s - text));
+                const char* line_end = NULL;
+                const float line_width = ImFontCalcTextSizeEx(font, font_size, FLT_MAX, 0.0f, s, text_end, text_end, &line_end, NULL, ImDrawTextFlags_StopOnNewLine).x;
+                cache->WidthMax = ImMax(cache->WidthMax, cache->WidthLast);
+                cache->WidthLast = line_width;
+                s = line_end;
+            }
+        }
+        cache->Lines.EndOffset = text_len;
+    }
+    if (cache->TextCopy.Size < text_len)
+    {
+        const int old_len = cache->TextCopy.Size;
+        cache->TextCopy.resize(text_len);
+        memcpy(cache->TextCopy.Data + old_len, text + old_len, (size_t)(text_len - old_len));
+    }
+}
+
+// Retrieve/update line index of a large text buffer submitted with ImGuiTextFlags_LineCache.
+// Buffers are keyed by pointer and ID scope. The same buffer laid out differently twice in a frame (e.g. at two wrap widths)
+// uses a second entry instead of evicting the first one.
+static ImGuiTextLineCache* TextLineCacheGet(const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiID id = ImHashData(&text, sizeof(text), g.CurrentWindow->IDStack.back());
+    ImGuiTextLineCache* cache = g.TextLineCaches.GetOrAddByKey(id);
+    if (cache->LastFrameActive == g.FrameCount && cache->TextBegin == text && (cache->Font != font || cache->FontSize != font_size || cache->WrapWidth != wrap_width))
+    {
+        id = ImHashData(&wrap_width, sizeof(wrap_width), ImHashData(&font_size, sizeof(font_size), ImHashData(&font, sizeof(font), id)));
+        cache = g.TextLineCaches.GetOrAddByKey(id);
+    }
+    TextLineCacheUpdate(cache, id, text, text_end, font, font_size, wrap_width, ImDrawTextFlags_None);
+    return cache;
+}
+
+// Double number of sets: entries of a set are split between two sets, so they always fit. Entries are moved with their buffers.
+static void TextWrapCacheGrow(ImVector<ImGuiTextLineCache>* table, int ways)
+{
+    ImVector<ImGuiTextLineCache> old_table;
+    old_table.swap(*table);
+    ImGuiTextLineCache unused_entry;
+    unused_entry.LastFrameActive = -1;
+    table->resize(ImMax(old_table.Size * 2, ways * 16), unused_entry);
+    const ImGuiID sets_mask = (ImGuiID)(table->Size / ways - 1);
+    for (ImGuiTextLineCache& entry : old_table)
+        if (entry.LastFrameActive != -1)
+        {
+            ImGuiTextLineCache* set = table->Data + (entry.ID & sets_mask) * ways;
+            int way_n = 0;
+            while (set[way_n].LastFrameActive != -1)
+                way_n++;
+            IM_ASSERT(way_n < ways);
+            memcpy(&set[way_n], &entry, sizeof(entry));
+        }
+}
+
+// Retrieve/update line index of wrapped text with current font, keyed by contents and baked font: formatted text and copies of a same text
+// find their entry again. The same text laid out at two wrap widths in a frame uses a second entry.
+// - Text is only laid out the second time it is seen: the first time, NULL is returned and the caller uses the regular path, so text changing
+//   every frame (e.g. formatted values) doesn't pay for a layout it would use only once.
+// - Entries are stored in a 4-way set-associative table and the least recently used entry of a set is recycled with its buffers, so text
+//   changing every frame doesn't allocate. Entries used in the current or previous frame are never recycled (as text is submitted in the same
+//   order every frame, that would evict entries about to be used): the table grows instead. Returns NULL when it can't grow anymore.
+static ImGuiTextLineCache* TextWrapCacheGet(const char* text, const char* text_end, float wrap_width, ImDrawTextFlags wrap_flags)
+{
+    ImGuiContext& g = *GImGui;
+    const int WAYS = 4;
+    const int ENTRIES_MAX = 4096;
+    ImVector<ImGuiTextLineCache>& table = g.TextWrapCaches;
+    if (table.Size == 0)
+        TextWrapCacheGrow(&table, WAYS);
+    ImGuiID id = ImHashDataFast(text, (size_t)(text_end - text), ImHashData(&wrap_flags, sizeof(wrap_flags), g.FontBaked->BakedId));
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        ImGuiTextLineCache* cache = NULL;
+        ImGuiTextLineCache* lru = NULL;
+        while (cache == NULL)
+        {
+            ImGuiTextLineCache* set = table.Data + (id & (ImGuiID)(table.Size / WAYS - 1)) * WAYS;
+            lru = NULL;
+            for (int way_n = 0; way_n < WAYS && cache == NULL; way_n++)
+            {
+                if (set[way_n].ID == id && set[way_n].LastFrameActive != -1)
+                    cache = &set[way_n];
+                else if (lru == NULL || set[way_n].LastFrameActive < lru->LastFrameActive)
+                    lru = &set[way_n];
+            }
+            if (cache != NULL)
+                break;
+            if (lru->LastFrameActive < g.FrameCount - 1)
+                break;
+            if (table.Size >= ENTRIES_MAX)
+                return NULL;
+            TextWrapCacheGrow(&table, WAYS);
+        }
+        if (cache == NULL)
+        {
+            // First time: only record text was seen
+            lru->ID = id;
+            lru->Font = NULL;
+            lru->WrapWidth = wrap_width;
+            lru->TextCopy.resize(0);
+            lru->LastTimeActive = (float)g.Time;
+            lru->LastFrameActive = g.FrameCount;
+            return NULL;
+        }
+
+        // Same text already laid out differently this frame: use a second entry
+        if (attempt == 0 && cache->LastFrameActive == g.FrameCount && cache->WrapWidth != wrap_width)
+        {
+            id = ImHashData(&wrap_width, sizeof(wrap_width), id);
+            continue;
+        }
+        TextLineCacheUpdate(cache, id, text, text_end, g.Font, g.FontSize, wrap_width, wrap_flags);
+        return cache;
+    }
+    return NULL;
+}
+
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -175,10 +370,63 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     const ImVec2 text_pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
     const float wrap_pos_x = window->DC.TextWrapPos;
     const bool wrap_enabled = (wrap_pos_x >= 0.0f);
-    if (text_end - text <= 2000 || wrap_enabled)
+    const bool large_text = (text_end - text > 2000);
+    const bool is_temp_buffer = (text >= g.TempBuffer.Data && text < g.TempBuffer.Data + g.TempBuffer.Size); // Formatted text: contents change while pointer stays the same
+    const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
+    const bool measure_all_lines = wrap_enabled || (flags & ImGuiTextFlags_NoWidthForLargeClippedText) == 0;
+    ImGuiTextLineCache* cache = NULL;
+    if ((flags & ImGuiTextFlags_LineCache) && large_text && !is_temp_buffer && !g.LogEnabled)
+        cache = TextLineCacheGet(text, text_end, measure_all_lines ? g.Font : NULL, g.FontSize, wrap_width);
+    else if (wrap_enabled && text != text_end && !g.LogEnabled)
+        cache = TextWrapCacheGet(text, text_end, wrap_width, ImDrawTextFlags_None);
+    if (cache != NULL)
+    {
+        // Use a persistent line index to jump straight to visible lines.
+        // - Large text: unless we need every line widths, we only split on '\n' and only measure visible lines (like the path below).
+        // - Wrapped text: size is known without walking the text, which is only rendered when visible.
+        // - We don't vertically center the text within the line full height, which is unlikely to matter because we are likely the biggest and only item on the line.
+        const float line_height = g.FontSize;
+        int lines_count = cache->Lines.size();
+        if (wrap_enabled && lines_count > 1 && cache->WidthLast == 0.0f && text_end[-1] != '\n')
+            lines_count--; // Same as CalcTextSize(): a last line with no width is not counted unless it is the only one (e.g. "Hello\n\r")
+
+        // Visible lines (same as IsClippedEx() on each line: a line starting exactly at the bottom of the clip rectangle is not visible)
+        const int line_first = ImClamp((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0, lines_count);
+        const int line_last = ImClamp((int)ImCeil((window->ClipRect.Max.y - text_pos.y) / line_height), line_first, lines_count);
+
+        ImVec2 text_size(0.0f, lines_count * line_height);
+        if (measure_all_lines)
+            text_size.x = IM_TRUNC(ImMax(cache->WidthMax, cache->WidthLast) + 0.99999f); // Same rounding as CalcTextSize()
+        else
+            for (int line_n = line_first; line_n < line_last; line_n++)
+                text_size.x = ImMax(text_size.x, CalcTextSize(cache->Lines.get_line_begin(text, line_n), cache->Lines.get_line_end(text, line_n)).x);
+        if (g.DebugTextLineCacheCheck && wrap_enabled)
+        {
+            const ImVec2 ref_size = CalcTextSize(text, text_end, false, wrap_width);
+            if (ref_size.x != text_size.x || ref_size.y != text_size.y)
+                g.DebugTextLineCacheErrors++;
+        }
+
+        ImRect bb(text_pos, text_pos + text_size);
+        ItemSize(text_size, 0.0f);
+        if (!ItemAdd(bb, 0))
+            return;
+
+        // Small text: render all of it, RenderText() clips lines itself.
+        // Otherwise when wrapping, also submit one line on each side and let RenderText() clip them, like the regular path rendering the whole text
+        // does: glyphs such as descenders overflow their line, so a line ending exactly at the top of the clip rectangle may still be visible.
+        const int render_first = !large_text ? 0 : wrap_enabled ? ImMax(line_first - 1, 0) : line_first;
+        const int render_last = !large_text ? lines_count : wrap_enabled ? ImMin(line_last + 1, lines_count) : line_last;
+        if (render_first < render_last)
+        {
+            const char* line_begin = cache->Lines.get_line_begin(text, render_first);
+            const char* line_end = (render_last < lines_count) ? cache->Lines.get_line_begin(text, render_last) : text_end;
+            RenderTextWrapped(ImVec2(bb.Min.x, (render_first == 0) ? bb.Min.y : IM_TRUNC(bb.Min.y) + render_first * line_height), line_begin, line_end, wrap_width);
+        }
+    }
+    else if (!large_text || wrap_enabled)
     {
         // Common case
-        const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
         const ImVec2 text_size = CalcTextSize(text_begin, text_end, false, wrap_width);
 
         ImRect bb(text_pos, text_pos + text_size);
@@ -269,6 +517,11 @@ void ImGui::TextUnformatted(const char* text, const char* text_end)
     TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
 }
 
+void ImGui::TextUnformattedAppendOnly(const char* text, const char* text_end)
+{
+    TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText | ImGuiTextFlags_LineCache);
+}
+
 void ImGui::Text(const char* fmt, ...)
 {
     va_list args;
@@ -4145,6 +4398,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
     // Offset remaining text (+ copy zero terminator)
     IM_ASSERT(obj->TextSrc == obj->TextA.Data);
+    obj->OnTextEdited(pos, n);
     char* dst = obj->TextA.Data + pos;
     char* src = obj->TextA.Data + pos + n;
     memmove(dst, src, obj->TextLen - n - pos + 1);
@@ -4154,7 +4408,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 
 static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
 {
-    const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_resizable = (obj->Flags & (ImGuiInputTextFlags_CallbackResize | ImGuiInputTextFlags_CallbackEditStream)) != 0;
     const int text_len = obj->TextLen;
     IM_ASSERT(pos <= text_len);
 
@@ -4173,6 +4427,7 @@ static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const cha
         obj->TextSrc = obj->TextA.Data;
     }
 
+    obj->OnTextEdited(pos, 0);
     char* text = obj->TextA.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
@@ -4242,6 +4497,20 @@ ImGuiInputTextState::~ImGuiInputTextState()
     IM_DELETE(Stb);
 }
 
+// Accumulate modified range for next LineIndex update. Text before 'pos' and after 'pos + delete_len' is unchanged.
+// Same for next ImGuiInputTextFlags_CallbackEditStream event.
+void ImGuiInputTextState::OnTextEdited(int pos, int delete_len)
+{
+    if (LineIndexEditBegin == INT_MAX)
+        LineIndexEditBegin = LineIndexEditTail = TextLen;
+    LineIndexEditBegin = ImMin(LineIndexEditBegin, pos);
+    LineIndexEditTail = ImMin(LineIndexEditTail, TextLen - (pos + delete_len));
+    if (EditStreamBegin == INT_MAX)
+        EditStreamBegin = EditStreamTail = EditStreamOldLen = TextLen;
+    EditStreamBegin = ImMin(EditStreamBegin, pos);
+    EditStreamTail = ImMin(EditStreamTail, TextLen - (pos + delete_len));
+}
+
 void ImGuiInputTextState::OnKeyPressed(int key)
 {
     stb_textedit_key(this, Stb, key);
@@ -4313,7 +4582,7 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     ImGuiContext& g = *Ctx;
     ImGuiInputTextState* obj = &g.InputTextState;
     IM_ASSERT(obj->ID != 0 && g.ActiveId == obj->ID);
-    const bool is_resizable = (Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_resizable = (Flags & (ImGuiInputTextFlags_CallbackResize | ImGuiInputTextFlags_CallbackEditStream)) != 0;
     const bool is_readonly = (Flags & ImGuiInputTextFlags_ReadOnly) != 0;
     int new_text_len = new_text_end ? (int)(new_text_end - new_text) : (int)ImStrlen(new_text);
 
@@ -4352,11 +4621,12 @@ void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexPageMap.Size == 0 && backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
     ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
     g.InputTextPasswordFontBackupFlags = g.Font->Flags;
     backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
+    backup->IndexPageMap.swap(g.FontBaked->IndexPageMap);
     backup->IndexLookup.swap(g.FontBaked->IndexLookup);
     backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
@@ -4371,9 +4641,10 @@ void ImGui::PopPasswordFont()
     g.Font->Flags = g.InputTextPasswordFontBackupFlags;
     g.FontBaked->FallbackGlyphIndex = backup->FallbackGlyphIndex;
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
+    g.FontBaked->IndexPageMap.swap(backup->IndexPageMap);
     g.FontBaked->IndexLookup.swap(backup->IndexLookup);
     g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexPageMap.Size == 0 && backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
 }
 
 // Return false to discard a character.
@@ -4504,6 +4775,8 @@ static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char*
 
     const int insert_len = new_last_diff - first_diff + 1;
     const int delete_len = old_last_diff - first_diff + 1;
+    IM_ASSERT(state->TextLen == old_length);
+    state->OnTextEdited(first_diff, delete_len);
     if (insert_len > 0 || delete_len > 0)
         if (IMSTB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->Stb->undostate, first_diff, delete_len, insert_len))
             for (int i = 0; i < delete_len; i++)
@@ -4521,7 +4794,7 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
     if (id == 0 || state->ID != id)
         return;
     g.InputTextDeactivatedState.ID = state->ID;
-    if (state->Flags & ImGuiInputTextFlags_ReadOnly)
+    if (state->Flags & (ImGuiInputTextFlags_ReadOnly | ImGuiInputTextFlags_CallbackEditStream)) // EditStream: edits were already sent to user.
     {
         g.InputTextDeactivatedState.TextA.resize(0); // In theory this data won't be used, but clear to be neat.
     }
@@ -4561,7 +4834,33 @@ static int InputTextLineIndexBuild(ImGuiInputTextFlags flags, ImGuiTextIndex* li
     ImGuiContext& g = *GImGui;
     int size = 0;
     const char* s;
-    if (flags & ImGuiInputTextFlags_WordWrap)
+    ImGuiTextLineCache* cache = NULL;
+    if ((flags & ImGuiInputTextFlags_WordWrap) && buf < buf_end && wrap_width > 0.0f)
+        cache = TextWrapCacheGet(buf, buf_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks);
+    if (cache != NULL)
+    {
+        // Word-wrapping: lines are cached with the text, so unchanged text is not wrapped again every frame
+        size = cache->Lines.size();
+        const int output_size = (size <= max_output_buffer_size) ? size : max_output_buffer_size + 1;
+        const int old_size = line_index->Offsets.Size;
+        line_index->Offsets.resize(old_size + output_size);
+        memcpy(line_index->Offsets.Data + old_size, cache->Lines.Offsets.Data, (size_t)output_size * sizeof(int));
+        if (g.DebugTextLineCacheCheck)
+        {
+            int ref_size = 0;
+            bool ref_match = true;
+            for (s = buf; s < buf_end; s = (*s == '\n') ? s + 1 : s)
+            {
+                ref_match &= (ref_size < size && cache->Lines.Offsets[ref_size] == (int)(s - buf));
+                ref_size++;
+                s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, buf_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks);
+            }
+            if (!ref_match || ref_size != size)
+                g.DebugTextLineCacheErrors++;
+        }
+        s = buf_end;
+    }
+    else if (flags & ImGuiInputTextFlags_WordWrap)
     {
         for (s = buf; s < buf_end; s = (*s == '\n') ? s + 1 : s)
         {
@@ -4607,6 +4906,76 @@ static int InputTextLineIndexBuild(ImGuiInputTextFlags flags, ImGuiTextIndex* li
     return size;
 }
 
+// Update persistent line index of an active multi-line InputText(), output is same as InputTextLineIndexBuild() with no size limit.
+// Only paragraphs touched by edits since last update are rescanned/rewrapped, following line offsets are shifted.
+static int InputTextLineIndexUpdate(ImGuiInputTextState* state, const char* buf, const char* buf_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextIndex* line_index = &state->LineIndex;
+    const int text_len = (int)(buf_end - buf);
+    if (state->LineIndexFont == NULL || state->LineIndexWrapWidth != wrap_width || (wrap_width > 0.0f && (state->LineIndexFont != g.Font || state->LineIndexFontSize != g.FontSize)))
+    {
+        line_index->Offsets.resize(0);
+        state->LineIndexEditBegin = state->LineIndexEditTail = 0;
+        state->LineIndexFont = g.Font;
+        state->LineIndexFontSize = g.FontSize;
+        state->LineIndexWrapWidth = wrap_width;
+    }
+    if (line_index->Offsets.Size == 0)
+        line_index->Offsets.push_back(0);
+    if (state->LineIndexEditBegin == INT_MAX)
+    {
+        IM_ASSERT(line_index->EndOffset == text_len);
+        return line_index->Offsets.Size;
+    }
+
+    // Find paragraphs touched by edits (wrapping never depends on contents of other paragraphs)
+    const int edit_begin = ImMin(state->LineIndexEditBegin, text_len);
+    const int edit_end = ImMax(edit_begin, text_len - state->LineIndexEditTail);
+    int para_begin = edit_begin;
+    while (para_begin > 0 && buf[para_begin - 1] != '\n')
+        para_begin--;
+    const char* para_eol = (const char*)ImMemchr(buf + edit_end, '\n', (size_t)(text_len - edit_end));
+    const int para_end = para_eol ? (int)(para_eol - buf) + 1 : text_len;
+    const int delta = text_len - line_index->EndOffset;
+
+    // Rebuild line starts within (para_begin, para_end] into temporary storage
+    ImVector<int>& new_offsets = g.InputTextLineIndex.Offsets;
+    new_offsets.resize(0);
+    for (const char* s = buf + para_begin; s < buf + para_end; new_offsets.push_back((int)(s - buf)))
+    {
+        if (wrap_width > 0.0f)
+            s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, buf_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks);
+        else if ((s = (const char*)ImMemchr(s, '\n', buf_end - s)) == NULL)
+            s = buf_end;
+        if (*s == '\n')
+            s++;
+        else if (s >= buf_end)
+            break;
+    }
+
+    // Replace old line starts within (para_begin, old_para_end], shift following ones
+    ImVector<int>& offsets = line_index->Offsets;
+    const int i0 = (int)(ImLowerBound(offsets.begin(), offsets.end(), para_begin + 1) - offsets.Data);
+    const int i1 = para_eol ? (int)(ImLowerBound(offsets.begin() + i0, offsets.end(), para_end - delta + 1) - offsets.Data) : offsets.Size;
+    const int tail_count = offsets.Size - i1;
+    const int new_size = i0 + new_offsets.Size + tail_count;
+    if (new_size > offsets.Size)
+        offsets.resize(new_size);
+    if (tail_count > 0 && i0 + new_offsets.Size != i1)
+        memmove(offsets.Data + i0 + new_offsets.Size, offsets.Data + i1, (size_t)tail_count * sizeof(int));
+    offsets.resize(new_size);
+    if (new_offsets.Size > 0)
+        memcpy(offsets.Data + i0, new_offsets.Data, (size_t)new_offsets.Size * sizeof(int));
+    if (delta != 0)
+        for (int n = i0 + new_offsets.Size; n < new_size; n++)
+            offsets.Data[n] += delta;
+
+    line_index->EndOffset = text_len;
+    state->LineIndexEditBegin = state->LineIndexEditTail = INT_MAX;
+    return offsets.Size;
+}
+
 static ImVec2 InputTextLineIndexGetPosOffset(ImGuiContext& g, ImGuiInputTextState* state, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, int cursor_n)
 {
     const char* cursor_ptr = buf + cursor_n;
@@ -4732,6 +5101,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
+    // Edit-stream API: edits are sent to user storage instead of writing back to 'buf'. Our own storage (state->TextA) stays contiguous.
+    const bool is_edit_stream = (flags & ImGuiInputTextFlags_CallbackEditStream) != 0;
+    if (is_edit_stream)
+        IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackEditStream flag!
 
     // Word-wrapping: enforcing a fixed width not altered by vertical scrollbar makes things easier, notably to track cursor reliably and avoid one-frame glitches.
     // Instead of using ImGuiWindowFlags_AlwaysVerticalScrollbar we account for that space if the scrollbar is not visible.
@@ -4760,6 +5133,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         IM_ASSERT(new_len + 1 <= buf_size && "Is your input buffer properly zero-terminated?");
         state->WantReloadUserBuf = false;
         InputTextReconcileUndoState(state, state->TextA.Data, state->TextLen, buf, new_len);
+        state->EditStreamBegin = INT_MAX; // Reloaded text comes from user storage: don't report it back as an edit.
         state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
         state->TextLen = new_len;
         memcpy(state->TextA.Data, buf, state->TextLen + 1);
@@ -4796,6 +5170,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
             memcpy(state->TextA.Data, buf, state->TextLen + 1);
         }
+        state->EditStreamBegin = INT_MAX;
 
         // Find initial scroll position for right alignment
         state->Scroll = ImVec2(0.0f, 0.0f);
@@ -4805,7 +5180,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Recycle existing cursor/selection/undo stack but clamp position
         // Note a single mouse click will override the cursor/position immediately by calling stb_textedit_click handler.
         if (!recycle_state)
+        {
             stb_textedit_initialize_state(state->Stb, !is_multiline);
+            state->LineIndexFont = NULL;
+        }
 
         if (!is_multiline)
         {
@@ -5306,8 +5684,32 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 }
             }
 
-            // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextSrc, buf) != 0)
+            // Will copy result string if modified, or send the modified range to user storage.
+            if (is_edit_stream)
+            {
+                if (state->EditStreamBegin != INT_MAX && !is_readonly)
+                {
+                    ImGuiInputTextCallbackData callback_data;
+                    callback_data.Ctx = &g;
+                    callback_data.EventFlag = ImGuiInputTextFlags_CallbackEditStream;
+                    callback_data.Flags = flags;
+                    callback_data.UserData = callback_user_data;
+                    callback_data.Buf = state->TextA.Data;
+                    callback_data.BufTextLen = state->TextLen;
+                    callback_data.BufSize = state->TextA.Size;
+                    callback_data.CursorPos = state->Stb->cursor;
+                    callback_data.SelectionStart = state->Stb->select_start;
+                    callback_data.SelectionEnd = state->Stb->select_end;
+                    callback_data.EditPos = ImMin(state->EditStreamBegin, ImMin(state->EditStreamOldLen, state->TextLen));
+                    callback_data.EditDeleteLen = ImMax(0, state->EditStreamOldLen - state->EditStreamTail - callback_data.EditPos);
+                    callback_data.EditInsertLen = ImMax(0, state->TextLen - state->EditStreamTail - callback_data.EditPos);
+                    state->EditStreamBegin = INT_MAX;
+                    callback(&callback_data);
+                    IM_ASSERT(callback_data.Buf == state->TextA.Data && !callback_data.BufDirty); // Buffer is read-only during this event.
+                    value_changed = true;
+                }
+            }
+            else if (!is_readonly && strcmp(state->TextSrc, buf) != 0)
             {
                 apply_new_text = state->TextSrc;
                 apply_new_text_length = state->TextLen;
@@ -5319,7 +5721,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Handle reapplying final data on deactivation (see InputTextDeactivateHook() for details)
     if (g.InputTextDeactivatedState.ID == id)
     {
-        if (g.ActiveId != id && IsItemDeactivatedAfterEdit() && !is_readonly && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
+        if (g.ActiveId != id && IsItemDeactivatedAfterEdit() && !is_readonly && !is_edit_stream && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
         {
             apply_new_text = g.InputTextDeactivatedState.TextA.Data;
             apply_new_text_length = g.InputTextDeactivatedState.TextA.Size - 1;
@@ -5330,7 +5732,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Copy result to user buffer. This can currently only happen when (g.ActiveId == id)
-    if (apply_new_text != NULL)
+    if (apply_new_text != NULL && !is_edit_stream)
     {
         //// We cannot test for 'backup_current_text_length != apply_new_text_length' here because we have no guarantee that the size
         //// of our owned buffer matches the size of the string object held by the user, and by design we allow InputText() to be used
@@ -5415,10 +5817,24 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         CalcClipRectVisibleItemsY(clip_rect, draw_pos, g.FontSize, &line_visible_n0, &line_visible_n1);
 
     // Build line index for easy data access (makes code below simpler and faster)
+    // When displaying our own copy of the text, the index is persistent and incrementally updated (large buffers would otherwise be rescanned every frame)
     ImGuiTextIndex* line_index = &g.InputTextLineIndex;
     line_index->Offsets.resize(0);
     int line_count = 1;
-    if (is_multiline)
+    if (is_multiline && buf_display_from_state && !is_displaying_hint)
+    {
+        line_index = &state->LineIndex;
+        line_count = InputTextLineIndexUpdate(state, buf_display, buf_display_end, wrap_width);
+        if (g.DebugInputTextLineIndexCheck)
+        {
+            ImVector<int>& ref_offsets = g.InputTextLineIndex.Offsets;
+            ref_offsets.resize(0);
+            InputTextLineIndexBuild(flags, &g.InputTextLineIndex, buf_display, buf_display_end, wrap_width, INT_MAX, NULL);
+            if (ref_offsets.Size != line_count || memcmp(ref_offsets.Data, line_index->Offsets.Data, (size_t)line_count * sizeof(int)) != 0)
+                g.DebugInputTextLineIndexErrors++;
+        }
+    }
+    else if (is_multiline)
     {
         // If scrolling is expected to change build full index.
         // FIXME-OPT: Could append to index when new value of line_visible_n1 becomes bigger, see second call to CalcClipRectVisibleItemsY() below.
@@ -7,6 +7,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/18: added ImGuiFreeType::LoadGlyphs() to rasterize glyphs ahead of time over multiple jobs, each with their own FT_Library/FT_Face/FT_Size.
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -267,14 +268,14 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
     const uint32_t h = ft_bitmap->rows;
     const uint8_t* src = ft_bitmap->buffer;
     const uint32_t src_pitch = ft_bitmap->pitch;
+    if (w == 0 || h == 0)
+        return;
 
     switch (ft_bitmap->pixel_mode)
     {
     case FT_PIXEL_MODE_GRAY: // Grayscale image, 1 byte per pixel.
         {
-            for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
-                for (uint32_t x = 0; x < w; x++)
-                    dst[x] = IM_COL32(255, 255, 255, src[x]);
+            ImFontAtlasTextureBlockConvert(src, ImTextureFormat_Alpha8, (int)src_pitch, (unsigned char*)dst, ImTextureFormat_RGBA32, (int)dst_pitch * 4, (int)w, (int)h); // Same as dst[x] = IM_COL32(255, 255, 255, src[x])
             break;
         }
     case FT_PIXEL_MODE_MONO: // Monochrome image, 1 bit per pixel. The bits in each byte are ordered from MSB to LSB.
@@ -344,39 +345,47 @@ static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size
     return block;
 }
 
-static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
+// Also used to create one library per job in ImGuiFreeType::LoadGlyphs()
+static FT_Error ImGui_ImplFreeType_NewLibrary(FT_Memory memory, FT_Library* out_library)
 {
-    IM_ASSERT(atlas->FontLoaderData == nullptr);
-    ImGui_ImplFreeType_Data* bd = IM_NEW(ImGui_ImplFreeType_Data)();
-
-    // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
-    bd->MemoryManager.user = nullptr;
-    bd->MemoryManager.alloc = &FreeType_Alloc;
-    bd->MemoryManager.free = &FreeType_Free;
-    bd->MemoryManager.realloc = &FreeType_Realloc;
-
     // https://www.freetype.org/freetype2/docs/reference/ft2-module_management.html#FT_New_Library
-    FT_Error error = FT_New_Library(&bd->MemoryManager, &bd->Library);
+    FT_Error error = FT_New_Library(memory, out_library);
     if (error != 0)
-    {
-        IM_DELETE(bd);
-        return false;
-    }
+        return error;
 
     // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
-    FT_Add_Default_Modules(bd->Library);
+    FT_Add_Default_Modules(*out_library);
 
 #ifdef IMGUI_ENABLE_FREETYPE_LUNASVG
     // Install svg hooks for FreeType
     // https://freetype.org/freetype2/docs/reference/ft2-properties.html#svg-hooks
     // https://freetype.org/freetype2/docs/reference/ft2-svg_fonts.html#svg_fonts
     SVG_RendererHooks hooks = { ImGuiLunasvgPortInit, ImGuiLunasvgPortFree, ImGuiLunasvgPortRender, ImGuiLunasvgPortPresetSlot };
-    FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", &hooks);
+    FT_Property_Set(*out_library, "ot-svg", "svg-hooks", &hooks);
 #endif // IMGUI_ENABLE_FREETYPE_LUNASVG
 #ifdef IMGUI_ENABLE_FREETYPE_PLUTOSVG
     // With plutosvg, use provided hooks
-    FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
+    FT_Property_Set(*out_library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
 #endif // IMGUI_ENABLE_FREETYPE_PLUTOSVG
+    return 0;
+}
+
+static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->FontLoaderData == nullptr);
+    ImGui_ImplFreeType_Data* bd = IM_NEW(ImGui_ImplFreeType_Data)();
+
+    // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
+    bd->MemoryManager.user = nullptr;
+    bd->MemoryManager.alloc = &FreeType_Alloc;
+    bd->MemoryManager.free = &FreeType_Free;
+    bd->MemoryManager.realloc = &FreeType_Realloc;
+
+    if (ImGui_ImplFreeType_NewLibrary(&bd->MemoryManager, &bd->Library) != 0)
+    {
+        IM_DELETE(bd);
+        return false;
+    }
 
     // Store our data
     atlas->FontLoaderData = (void*)bd;
@@ -418,24 +427,13 @@ static void ImGui_ImplFreeType_FontSrcDestroy(ImFontAtlas* atlas, ImFontConfig*
     src->FontLoaderData = nullptr;
 }
 
-static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+// Set the size of the currently active FT_Size of a face for a given baked font.
+static void ImGui_ImplFreeType_RequestSize(ImGui_ImplFreeType_FontSrcData* bd_font_data, ImFontConfig* src, ImFontBaked* baked)
 {
-    IM_UNUSED(atlas);
     float size = baked->Size;
     if (src->MergeMode && src->SizePixels != 0.0f)
         size *= (src->SizePixels / baked->OwnerFont->Sources[0]->SizePixels);
 
-    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    bd_font_data->BakedLastActivated = baked;
-
-    // We use one FT_Size per (source + baked) combination.
-    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
-    IM_ASSERT(bd_baked_data != nullptr);
-    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
-
-    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
-    FT_Activate_Size(bd_baked_data->FtSize);
-
     // Vuhdo 2017: "I'm not sure how to deal with font sizes properly. As far as I understand, currently ImGui assumes that the 'pixel_height'
     // is a maximum height of an any given glyph, i.e. it's the sum of font's ascender and descender. Seems strange to me.
     // FT_Set_Pixel_Sizes() doesn't seem to get us the same result."
@@ -448,11 +446,28 @@ static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* s
     req.horiResolution = 0;
     req.vertResolution = 0;
     FT_Request_Size(bd_font_data->FtFace, &req);
+}
+
+static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    bd_font_data->BakedLastActivated = baked;
+
+    // We use one FT_Size per (source + baked) combination.
+    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+    IM_ASSERT(bd_baked_data != nullptr);
+    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
+
+    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
+    FT_Activate_Size(bd_baked_data->FtSize);
+    ImGui_ImplFreeType_RequestSize(bd_font_data, src, baked);
 
     // Output
     if (src->MergeMode == false)
     {
         // Read metrics
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
         FT_Size_Metrics metrics = bd_baked_data->FtSize->metrics;
         const float scale = 1.0f / rasterizer_density;
         baked->Ascent     = (float)FT_CEIL(metrics.ascender) * scale;       // The pixel extents above the baseline in pixels (typically positive).
@@ -475,37 +490,32 @@ static void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
-static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Rasterized glyph, before being packed into the atlas.
+struct ImGui_ImplFreeType_RenderedGlyph
 {
-    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
-    if (glyph_index == 0)
-        return false;
-
-    if (bd_font_data->BakedLastActivated != baked) // <-- could use id
-    {
-        // Activate current size
-        ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
-        FT_Activate_Size(bd_baked_data->FtSize);
-        bd_font_data->BakedLastActivated = baked;
-    }
+    ImWchar     Codepoint;
+    int         SrcIdx;                 // Index in font->Sources[]
+    bool        Loaded;
+    bool        Colored;
+    float       AdvanceX;
+    int         Width, Height;
+    int         BitmapLeft, BitmapTop;
+    int         PixelsOffset;           // Offset of RGBA32 pixels in job output buffer
+};
 
+// Load glyph using the currently active FT_Size of the face, and unless 'only_load_advance_x' is set, render it into the glyph slot bitmap.
+// Only touches data owned by 'bd_font_data', so this may be called concurrently on faces from different FT_Library.
+static bool ImGui_ImplFreeType_RenderGlyph(ImGui_ImplFreeType_FontSrcData* bd_font_data, float rasterizer_density, ImWchar codepoint, bool only_load_advance_x, ImGui_ImplFreeType_RenderedGlyph* out_rendered)
+{
     const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint);
     if (metrics == nullptr)
         return false;
 
-    FT_Face face = bd_font_data->FtFace;
-    FT_GlyphSlot slot = face->glyph;
-    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
-
-    // Load metrics only mode
-    const float advance_x = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance_x;
+    FT_GlyphSlot slot = bd_font_data->FtFace->glyph;
+    out_rendered->Codepoint = codepoint;
+    out_rendered->AdvanceX = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
+    if (only_load_advance_x)
         return true;
-    }
 
     // Render glyph into a bitmap (currently held by FreeType)
     FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
@@ -516,16 +526,29 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
 
     const int w = (int)ft_bitmap->width;
     const int h = (int)ft_bitmap->rows;
+    out_rendered->Width = w;
+    out_rendered->Height = h;
+    out_rendered->BitmapLeft = slot->bitmap_left;
+    out_rendered->BitmapTop = slot->bitmap_top;
+    out_rendered->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+    return true;
+}
+
+// Pack rasterized glyph into the atlas and register its position.
+static bool ImGui_ImplFreeType_PackRenderedGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, const ImGui_ImplFreeType_RenderedGlyph* rendered, const unsigned char* pixels, ImFontGlyph* out_glyph)
+{
+    const int w = rendered->Width;
+    const int h = rendered->Height;
     const bool is_visible = (w != 0 && h != 0);
 
     // Prepare glyph
-    out_glyph->Codepoint = codepoint;
-    out_glyph->AdvanceX = advance_x;
+    out_glyph->Codepoint = rendered->Codepoint;
+    out_glyph->AdvanceX = rendered->AdvanceX;
 
     // Pack and retrieve position inside texture atlas
     if (is_visible)
     {
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h, NULL, true, rendered->Colored);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
             // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
@@ -534,11 +557,6 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
-        // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
-        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
-
         const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
         float font_off_x = (src->GlyphOffset.x * offsets_scale);
@@ -547,25 +565,60 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
             font_off_x = IM_ROUND(font_off_x);
         if (src->PixelSnapV)
             font_off_y = IM_ROUND(font_off_y);
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
         float recip_h = 1.0f / rasterizer_density;
         float recip_v = 1.0f / rasterizer_density;
 
         // Register glyph
-        float glyph_off_x = (float)face->glyph->bitmap_left;
-        float glyph_off_y = (float)-face->glyph->bitmap_top;
+        float glyph_off_x = (float)rendered->BitmapLeft;
+        float glyph_off_y = (float)-rendered->BitmapTop;
         out_glyph->X0 = glyph_off_x * recip_h + font_off_x;
         out_glyph->Y0 = glyph_off_y * recip_v + font_off_y;
         out_glyph->X1 = (glyph_off_x + w) * recip_h + font_off_x;
         out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
-        out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+        out_glyph->Colored = rendered->Colored;
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, pixels, ImTextureFormat_RGBA32, w * 4);
     }
 
     return true;
 }
 
+static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
+    if (glyph_index == 0)
+        return false;
+
+    if (bd_font_data->BakedLastActivated != baked) // <-- could use id
+    {
+        // Activate current size
+        ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+        FT_Activate_Size(bd_baked_data->FtSize);
+        bd_font_data->BakedLastActivated = baked;
+    }
+
+    ImGui_ImplFreeType_RenderedGlyph rendered = {};
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    if (!ImGui_ImplFreeType_RenderGlyph(bd_font_data, rasterizer_density, codepoint, out_advance_x != NULL, &rendered))
+        return false;
+
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        *out_advance_x = rendered.AdvanceX;
+        return true;
+    }
+
+    // Render pixels to our temporary buffer
+    atlas->Builder->TempBuffer.resize(rendered.Width * rendered.Height * 4);
+    ImGui_ImplFreeType_BlitGlyph(&bd_font_data->FtFace->glyph->bitmap, (uint32_t*)(void*)atlas->Builder->TempBuffer.Data, rendered.Width);
+    return ImGui_ImplFreeType_PackRenderedGlyph(atlas, src, baked, &rendered, atlas->Builder->TempBuffer.Data, out_glyph);
+}
+
 static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
 {
     IM_UNUSED(atlas);
@@ -574,9 +627,9 @@ static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontCo
     return glyph_index != 0;
 }
 
-const ImFontLoader* ImGuiFreeType::GetFontLoader()
+static ImFontLoader ImGui_ImplFreeType_CreateLoader()
 {
-    static ImFontLoader loader;
+    ImFontLoader loader;
     loader.Name = "FreeType";
     loader.LoaderInit = ImGui_ImplFreeType_LoaderInit;
     loader.LoaderShutdown = ImGui_ImplFreeType_LoaderShutdown;
@@ -587,6 +640,12 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
+    return loader;
+}
+
+const ImFontLoader* ImGuiFreeType::GetFontLoader()
+{
+    static const ImFontLoader loader = ImGui_ImplFreeType_CreateLoader(); // Thread-safe initialization
     return &loader;
 }
 
@@ -597,6 +656,215 @@ void ImGuiFreeType::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* u
     GImGuiFreeTypeAllocatorUserData = user_data;
 }
 
+// Memory allocation callbacks for jobs of ImGuiFreeType::LoadGlyphs().
+// Default allocators use IM_ALLOC() which updates context counters and is not thread-safe: use malloc()/free() instead unless custom allocators are set.
+static void* FreeType_JobAlloc(FT_Memory memory, long size)
+{
+    if (GImGuiFreeTypeAllocFunc != ImGuiFreeTypeDefaultAllocFunc)
+        return FreeType_Alloc(memory, size);
+    return malloc((size_t)size);
+}
+
+static void FreeType_JobFree(FT_Memory memory, void* block)
+{
+    if (GImGuiFreeTypeAllocFunc != ImGuiFreeTypeDefaultAllocFunc)
+        FreeType_Free(memory, block);
+    else
+        free(block);
+}
+
+static void* FreeType_JobRealloc(FT_Memory memory, long cur_size, long new_size, void* block)
+{
+    if (GImGuiFreeTypeAllocFunc != ImGuiFreeTypeDefaultAllocFunc)
+        return FreeType_Realloc(memory, cur_size, new_size, block);
+    if (new_size == 0)
+    {
+        free(block);
+        return nullptr;
+    }
+    return realloc(block, (size_t)new_size);
+}
+
+// Glyphs rasterized by one job of ImGuiFreeType::LoadGlyphs().
+// Each job has its own FT_Library, with its own FT_Face and FT_Size for each source, so jobs can run concurrently.
+struct ImGui_ImplFreeType_GlyphsJob
+{
+    FT_Library                                  Library;
+    ImVector<ImGui_ImplFreeType_FontSrcData*>   SrcDatas;       // One for each font->Sources[], nullptr when the source doesn't use this loader.
+    ImVector<ImGui_ImplFreeType_RenderedGlyph>  Glyphs;         // Input: Codepoint, SrcIdx. Output: other fields.
+    unsigned char*                              Pixels;         // Output: RGBA32 pixels of all rendered glyphs. Allocated with job memory callbacks as ImVector<> would use IM_ALLOC().
+    int                                         PixelsSize;
+    int                                         PixelsCapacity;
+    ImGui_ImplFreeType_GlyphsJob()              { Library = nullptr; Pixels = nullptr; PixelsSize = PixelsCapacity = 0; }
+};
+
+struct ImGui_ImplFreeType_GlyphsJobs
+{
+    ImFontBaked*                                Baked;
+    FT_MemoryRec_                               MemoryManager;
+    ImVector<ImGui_ImplFreeType_GlyphsJob*>     Jobs;
+};
+
+static void ImGui_ImplFreeType_RunGlyphsJob(void* job_data, int job_n)
+{
+    ImGui_ImplFreeType_GlyphsJobs* jobs = (ImGui_ImplFreeType_GlyphsJobs*)job_data;
+    ImGui_ImplFreeType_GlyphsJob* job = jobs->Jobs[job_n];
+    ImFontBaked* baked = jobs->Baked;
+    for (ImGui_ImplFreeType_RenderedGlyph& rendered : job->Glyphs)
+    {
+        ImFontConfig* src = baked->OwnerFont->Sources[rendered.SrcIdx];
+        ImGui_ImplFreeType_FontSrcData* job_src_data = job->SrcDatas[rendered.SrcIdx];
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+        rendered.Loaded = ImGui_ImplFreeType_RenderGlyph(job_src_data, rasterizer_density, rendered.Codepoint, false, &rendered);
+        if (!rendered.Loaded)
+            continue;
+
+        // Render pixels to job buffer
+        const int pixels_size = rendered.Width * rendered.Height * 4;
+        if (job->PixelsSize + pixels_size > job->PixelsCapacity)
+        {
+            const int new_capacity = ImMax(ImMax(job->PixelsCapacity * 2, job->PixelsSize + pixels_size), 64 * 1024);
+            unsigned char* new_pixels = (unsigned char*)FreeType_JobRealloc(&jobs->MemoryManager, job->PixelsCapacity, new_capacity, job->Pixels);
+            if (new_pixels == nullptr)
+            {
+                rendered.Loaded = false; // Out of memory: keep previous buffer, regular path will try again
+                continue;
+            }
+            job->Pixels = new_pixels;
+            job->PixelsCapacity = new_capacity;
+        }
+        rendered.PixelsOffset = job->PixelsSize;
+        ImGui_ImplFreeType_BlitGlyph(&job_src_data->FtFace->glyph->bitmap, (uint32_t*)(void*)(job->Pixels + rendered.PixelsOffset), rendered.Width);
+        job->PixelsSize += pixels_size;
+    }
+}
+
+int ImGuiFreeType::LoadGlyphs(ImFont* font, float font_size, const ImWchar* glyph_ranges, int jobs_count, ImGuiFreeTypeRunJobsFunc run_jobs_func, void* run_jobs_user_data)
+{
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    IM_ASSERT(glyph_ranges != nullptr && jobs_count > 0);
+    IM_ASSERT_USER_ERROR(!ImFontAtlasIsSharedReadOnly(atlas), "Thread-shared atlas may only be modified while holding its write lock, see ImFontAtlasLockExclusive().");
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+        return 0;
+    ImFontBaked* baked = font->GetFontBaked(font_size);
+
+    // Sources using this loader
+    ImVector<bool> src_uses_loader;
+    src_uses_loader.resize(font->Sources.Size);
+    bool any_src_uses_loader = false;
+    for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+    {
+        ImFontConfig* src = font->Sources[src_n];
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        src_uses_loader[src_n] = (loader->FontBakedLoadGlyph == ImGui_ImplFreeType_FontBakedLoadGlyph && src->FontLoaderData != nullptr);
+        any_src_uses_loader |= src_uses_loader[src_n];
+    }
+    if (!any_src_uses_loader)
+        return 0;
+
+    // Gather code-points which are not loaded yet, and are provided by a source using this loader
+    ImVector<ImGui_ImplFreeType_RenderedGlyph> glyphs;
+    for (const ImWchar* range = glyph_ranges; range[0] != 0 && range[1] != 0; range += 2)
+        for (unsigned int c = range[0]; c <= range[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++)
+        {
+            const ImWchar codepoint = (ImWchar)c;
+            if (baked->IsGlyphLoaded(codepoint))
+                continue;
+            if ((codepoint == font->EllipsisChar && font->EllipsisAutoBake) || (font->RemapPairs.Data.Size != 0 && font->RemapPairs.GetInt(codepoint, codepoint) != codepoint))
+                continue; // Leave special cases to the regular path
+            const int src_n = ImFontAtlasFontResolveSource(atlas, font, codepoint);
+            if (src_n == -1 || !src_uses_loader[src_n])
+                continue;
+            ImGui_ImplFreeType_RenderedGlyph rendered = {};
+            rendered.Codepoint = codepoint;
+            rendered.SrcIdx = src_n;
+            glyphs.push_back(rendered);
+        }
+    if (glyphs.Size == 0)
+        return 0;
+    jobs_count = ImMin(jobs_count, glyphs.Size);
+
+    // Create per-job library, faces and sizes, sharing font data (not copied).
+    // This is done on the calling thread as InitFont() may write to ImFontConfig.
+    ImGui_ImplFreeType_GlyphsJobs jobs;
+    jobs.Baked = baked;
+    jobs.MemoryManager.user = nullptr;
+    jobs.MemoryManager.alloc = &FreeType_JobAlloc;
+    jobs.MemoryManager.free = &FreeType_JobFree;
+    jobs.MemoryManager.realloc = &FreeType_JobRealloc;
+    bool jobs_ready = true;
+    for (int job_n = 0; job_n < jobs_count && jobs_ready; job_n++)
+    {
+        ImGui_ImplFreeType_GlyphsJob* job = IM_NEW(ImGui_ImplFreeType_GlyphsJob)();
+        jobs.Jobs.push_back(job);
+        if (ImGui_ImplFreeType_NewLibrary(&jobs.MemoryManager, &job->Library) != 0)
+        {
+            jobs_ready = false;
+            break;
+        }
+        job->SrcDatas.resize(font->Sources.Size, nullptr);
+        for (int src_n = 0; src_n < font->Sources.Size && jobs_ready; src_n++)
+        {
+            if (!src_uses_loader[src_n])
+                continue;
+            ImFontConfig* src = font->Sources[src_n];
+            ImGui_ImplFreeType_FontSrcData* job_src_data = IM_NEW(ImGui_ImplFreeType_FontSrcData);
+            job->SrcDatas[src_n] = job_src_data;
+            if (!job_src_data->InitFont(job->Library, src, (ImGuiFreeTypeLoaderFlags)atlas->FontLoaderFlags))
+            {
+                jobs_ready = false;
+                break;
+            }
+            FT_Size ft_size;
+            FT_New_Size(job_src_data->FtFace, &ft_size); // Owned by face
+            FT_Activate_Size(ft_size);
+            ImGui_ImplFreeType_RequestSize(job_src_data, src, baked);
+        }
+
+        // Interleave code-points to balance jobs
+        for (int glyph_n = job_n; glyph_n < glyphs.Size; glyph_n += jobs_count)
+            job->Glyphs.push_back(glyphs[glyph_n]);
+    }
+
+    // Rasterize
+    if (jobs_ready)
+    {
+        if (run_jobs_func != nullptr)
+            run_jobs_func(ImGui_ImplFreeType_RunGlyphsJob, &jobs, jobs_count, run_jobs_user_data);
+        else
+            for (int job_n = 0; job_n < jobs_count; job_n++)
+                ImGui_ImplFreeType_RunGlyphsJob(&jobs, job_n);
+    }
+
+    // Pack and add glyphs, in code-point order
+    int loaded_count = 0;
+    for (int glyph_n = 0; jobs_ready && glyph_n < glyphs.Size; glyph_n++)
+    {
+        ImGui_ImplFreeType_GlyphsJob* job = jobs.Jobs[glyph_n % jobs_count];
+        const ImGui_ImplFreeType_RenderedGlyph* rendered = &job->Glyphs[glyph_n / jobs_count];
+        if (!rendered->Loaded)
+            continue; // Regular path will try again
+        ImFontConfig* src = font->Sources[rendered->SrcIdx];
+        ImFontGlyph glyph_buf;
+        if (!ImGui_ImplFreeType_PackRenderedGlyph(atlas, src, baked, rendered, job->Pixels + rendered->PixelsOffset, &glyph_buf))
+            break;
+        glyph_buf.SourceIdx = rendered->SrcIdx;
+        ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+        loaded_count++;
+    }
+
+    for (ImGui_ImplFreeType_GlyphsJob* job : jobs.Jobs)
+    {
+        for (ImGui_ImplFreeType_FontSrcData* job_src_data : job->SrcDatas)
+            IM_DELETE(job_src_data);
+        if (job->Library)
+            FT_Done_Library(job->Library);
+        FreeType_JobFree(&jobs.MemoryManager, job->Pixels);
+        IM_DELETE(job);
+    }
+    return loaded_count;
+}
+
 bool ImGuiFreeType::DebugEditFontLoaderFlags(unsigned int* p_font_loader_flags)
 {
     bool edited = false;
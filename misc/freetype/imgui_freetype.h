@@ -58,6 +58,11 @@ enum ImGuiFreeTypeLoaderFlags_
 typedef ImGuiFreeTypeLoaderFlags_ ImGuiFreeTypeBuilderFlags_;
 #endif
 
+// Job system hook for ImGuiFreeType::LoadGlyphs()
+// Must call 'job_func(job_data, job_n)' once for each job_n in [0, jobs_count), from any threads, and only return once all calls have completed.
+typedef void (*ImGuiFreeTypeJobFunc)(void* job_data, int job_n);
+typedef void (*ImGuiFreeTypeRunJobsFunc)(ImGuiFreeTypeJobFunc job_func, void* job_data, int jobs_count, void* user_data);
+
 namespace ImGuiFreeType
 {
     // This is automatically assigned when using '#define IMGUI_ENABLE_FREETYPE'.
@@ -70,6 +75,14 @@ namespace ImGuiFreeType
     // However, as FreeType does lots of allocations we provide a way for the user to redirect it to a separate memory heap if desired.
     IMGUI_API void                      SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = nullptr);
 
+    // Load glyphs of a given font size ahead of time, rasterizing them in parallel (e.g. a large CJK range). Returns number of glyphs loaded.
+    // - Each job uses its own FT_Library, FT_Face and FT_Size, opened from the same font data (not copied). Packing into the atlas happens on the calling thread.
+    // - Jobs are submitted with 'run_jobs_func', or run sequentially on the calling thread if it is NULL.
+    // - Allocators (see SetAllocatorFunctions()) are called from jobs and need to be thread-safe.
+    // - Glyphs from sources not using this loader are left to be loaded on demand as usual.
+    // - This modifies the atlas: with ImFontAtlasFlags_ThreadShared, call it while holding the write lock (ImFontAtlasLockExclusive()), or before other threads use the atlas.
+    IMGUI_API int                       LoadGlyphs(ImFont* font, float font_size, const ImWchar* glyph_ranges, int jobs_count, ImGuiFreeTypeRunJobsFunc run_jobs_func = nullptr, void* run_jobs_user_data = nullptr);
+
     // Display UI to edit ImFontAtlas::FontLoaderFlags (shared) or ImFontConfig::FontLoaderFlags (single source)
     IMGUI_API bool                      DebugEditFontLoaderFlags(ImGuiFreeTypeLoaderFlags* p_font_loader_flags);
 
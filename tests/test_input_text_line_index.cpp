@@ -0,0 +1,170 @@
+// Dear ImGui: multi-line InputText() line index test
+// An active multi-line InputText() keeps a persistent line index, only updating paragraphs touched by edits (InputTextLineIndexUpdate()).
+// This checks that it always matches a full rebuild with InputTextLineIndexBuild() (ImGuiContext::DebugInputTextLineIndexCheck), while random edits
+// are applied: typing, new lines, deletions, selections, cut/paste, undo/redo, with and without word wrapping, with random widths and font sizes.
+// Usage:
+//   ./test_input_text_line_index [--seeds=N] [--frames=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImGuiContext, ImGuiInputTextState
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Deterministic pseudo-random numbers (LCG)
+static int TestRand(unsigned int* seed, int n)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (int)((*seed >> 8) % (unsigned int)n);
+}
+
+static void AddKeyPress(ImGuiIO& io, ImGuiKey key, bool ctrl, bool shift)
+{
+    if (ctrl)
+        io.AddKeyEvent(ImGuiMod_Ctrl, true);
+    if (shift)
+        io.AddKeyEvent(ImGuiMod_Shift, true);
+    io.AddKeyEvent(key, true);
+    io.AddKeyEvent(key, false);
+    if (shift)
+        io.AddKeyEvent(ImGuiMod_Shift, false);
+    if (ctrl)
+        io.AddKeyEvent(ImGuiMod_Ctrl, false);
+}
+
+// Queue random edits. Events are trickled over the following frames (io.ConfigInputTrickleEventQueue).
+static void AddRandomEdits(ImGuiIO& io, unsigned int* seed)
+{
+    static const ImGuiKey move_keys[] = { ImGuiKey_LeftArrow, ImGuiKey_RightArrow, ImGuiKey_UpArrow, ImGuiKey_DownArrow, ImGuiKey_Home, ImGuiKey_End, ImGuiKey_PageUp, ImGuiKey_PageDown };
+    switch (TestRand(seed, 12))
+    {
+    case 0: case 1: case 2:
+    {
+        // Type a word, sometimes non-ASCII
+        const int len = 1 + TestRand(seed, 12);
+        for (int n = 0; n < len; n++)
+            io.AddInputCharacter((TestRand(seed, 8) == 0) ? (unsigned int)(0xE0 + TestRand(seed, 32)) : (unsigned int)('a' + TestRand(seed, 26)));
+        io.AddInputCharacter(' ');
+        break;
+    }
+    case 3:
+        AddKeyPress(io, ImGuiKey_Enter, false, false);
+        break;
+    case 4:
+        AddKeyPress(io, TestRand(seed, 2) ? ImGuiKey_Backspace : ImGuiKey_Delete, TestRand(seed, 4) == 0, false);
+        break;
+    case 5: case 6: case 7:
+        AddKeyPress(io, move_keys[TestRand(seed, IM_ARRAYSIZE(move_keys))], TestRand(seed, 4) == 0, TestRand(seed, 3) == 0);
+        break;
+    case 8:
+        AddKeyPress(io, (TestRand(seed, 4) == 0) ? ImGuiKey_X : ImGuiKey_C, true, false); // Cut or copy selection
+        break;
+    case 9:
+        AddKeyPress(io, ImGuiKey_V, true, false);
+        break;
+    case 10:
+        AddKeyPress(io, TestRand(seed, 2) ? ImGuiKey_Z : ImGuiKey_Y, true, false);
+        break;
+    case 11:
+        if (TestRand(seed, 50) == 0)
+            AddKeyPress(io, ImGuiKey_A, true, false); // Select all, to be replaced by next edit
+        break;
+    }
+}
+
+// Returns number of frames where the incremental line index didn't match a full rebuild.
+static int RunTest(unsigned int test_seed, int frames_count)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1280.0f, 800.0f);
+    ImGui_ImplNull_Init();
+    ctx->DebugInputTextLineIndexCheck = true;
+
+    // Initial text: paragraphs of random length, including empty ones and very long ones
+    unsigned int seed = test_seed;
+    static char buf[64 * 1024];
+    char* p = buf;
+    for (int para_n = 0; para_n < 40 && p < buf + 32 * 1024; para_n++)
+    {
+        const int words_count = (TestRand(&seed, 4) == 0) ? 0 : TestRand(&seed, (TestRand(&seed, 8) == 0) ? 200 : 20);
+        for (int word_n = 0; word_n < words_count; word_n++)
+        {
+            const int len = 1 + TestRand(&seed, 10);
+            for (int n = 0; n < len; n++)
+                *p++ = (char)('a' + TestRand(&seed, 26));
+            *p++ = ' ';
+            if (TestRand(&seed, 6) == 0)
+                *p++ = ' ';
+        }
+        *p++ = '\n';
+    }
+    *p = 0;
+
+    ImGuiInputTextFlags flags = ImGuiInputTextFlags_None;
+    float width = 400.0f;
+    float font_size = 13.0f;
+    int checked_frames = 0;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        // Occasionally change wrapping mode, width and font size
+        if (TestRand(&seed, 100) == 0)
+            flags ^= ImGuiInputTextFlags_WordWrap;
+        if (TestRand(&seed, 50) == 0)
+            width = 100.0f + TestRand(&seed, 600);
+        if (TestRand(&seed, 100) == 0)
+            font_size = 10.0f + TestRand(&seed, 20);
+        if (TestRand(&seed, 3) == 0 && io.InputQueueCharacters.Size == 0)
+            AddRandomEdits(io, &seed);
+
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImVec2(width + 50.0f, 600.0f));
+        ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::PushFont(NULL, font_size);
+        if (frame_n == 0)
+            ImGui::SetKeyboardFocusHere();
+        ImGui::InputTextMultiline("##text", buf, IM_ARRAYSIZE(buf), ImVec2(width, 500.0f), flags);
+        if (ImGui::GetInputTextState(ImGui::GetItemID()) != NULL)
+            checked_frames++;
+        ImGui::PopFont();
+        ImGui::End();
+        ImGui::Render();
+        ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    }
+
+    const int errors = ctx->DebugInputTextLineIndexErrors;
+    printf("test_input_text_line_index: seed %u, %d frames, %d checked, text length %d, %d errors\n", test_seed, frames_count, checked_frames, (int)strlen(buf), errors);
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext(ctx);
+    return (checked_frames == 0) ? 1 : errors;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int seeds_count = 5;
+    int frames_count = 3000;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--seeds=", 8) == 0)
+            seeds_count = ImMax(1, atoi(argv[arg_n] + 8));
+        else if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            frames_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--seeds=N] [--frames=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int failures = 0;
+    for (int seed_n = 0; seed_n < seeds_count; seed_n++)
+        failures += (RunTest(1000u + (unsigned int)seed_n, frames_count) != 0) ? 1 : 0;
+    printf("test_input_text_line_index: %s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
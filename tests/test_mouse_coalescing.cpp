@@ -0,0 +1,196 @@
+// Dear ImGui: mouse events coalescing test
+// With io.ConfigInputCoalesceMouseEvents, consecutive mouse move events and consecutive mouse wheel events are merged in the input queue.
+// This must not change the resulting io state: two contexts receive the same random events (moves, wheels, buttons, mouse sources, keys, text),
+// one with coalescing and one without, and io state, raw position samples (GetMousePosSamples()) and UI state must be identical on every frame.
+// Usage:
+//   ./test_mouse_coalescing [--seeds=N] [--frames=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImGuiContext
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Deterministic pseudo-random numbers (LCG)
+static int TestRand(unsigned int* seed, int n)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (int)((*seed >> 8) % (unsigned int)n);
+}
+
+// Widgets data, one for each context
+struct TestData
+{
+    float       Value = 0.0f;
+    char        Buf[64] = "";
+};
+
+static ImGuiContext* CreateTestContext(bool coalesce)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1280.0f, 800.0f);
+    io.ConfigInputCoalesceMouseEvents = coalesce;
+    ImGui_ImplNull_Init();
+    return ctx;
+}
+
+// Queue a random burst of events. Called with the same seed for both contexts.
+static void AddRandomEvents(ImGuiIO& io, unsigned int* seed)
+{
+    const int events_count = TestRand(seed, 12);
+    for (int event_n = 0; event_n < events_count; event_n++)
+    {
+        const int kind = TestRand(seed, 20);
+        if (kind < 10)
+        {
+            // Fractional positions: samples are not rounded, events are
+            const float x = (TestRand(seed, 30) == 0) ? -FLT_MAX : TestRand(seed, 1300 * 4) * 0.25f;
+            const float y = (x == -FLT_MAX) ? -FLT_MAX : TestRand(seed, 820 * 4) * 0.25f;
+            io.AddMousePosEvent(x, y);
+        }
+        else if (kind < 14)
+            io.AddMouseWheelEvent((TestRand(seed, 3) == 0) ? (TestRand(seed, 5) - 2) * 0.5f : 0.0f, (TestRand(seed, 9) - 4) * 0.25f);
+        else if (kind < 16)
+            io.AddMouseButtonEvent(TestRand(seed, 3), TestRand(seed, 2) != 0);
+        else if (kind == 16)
+            io.AddMouseSourceEvent((ImGuiMouseSource)TestRand(seed, ImGuiMouseSource_COUNT));
+        else if (kind == 17)
+            io.AddKeyEvent(TestRand(seed, 2) ? ImGuiKey_LeftShift : ImGuiKey_A, TestRand(seed, 2) != 0);
+        else if (kind == 18)
+            io.AddInputCharacter('a' + TestRand(seed, 26));
+        else
+            io.AddFocusEvent(TestRand(seed, 8) != 0);
+    }
+}
+
+static void ShowTestFrame(TestData* data)
+{
+    ImGui::SetNextWindowPos(ImVec2(100.0f, 100.0f), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(600.0f, 500.0f), ImGuiCond_Once);
+    ImGui::Begin("Test");
+    ImGui::BeginChild("scrolling", ImVec2(0.0f, 300.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar);
+    for (int line_n = 0; line_n < 100; line_n++)
+    {
+        ImGui::PushID(line_n);
+        ImGui::Button("Button");
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(1000.0f);
+        ImGui::SliderFloat("##slider", &data->Value, 0.0f, 1.0f);
+        ImGui::PopID();
+    }
+    ImGui::EndChild();
+    ImGui::InputText("text", data->Buf, IM_ARRAYSIZE(data->Buf));
+    ImGui::End();
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+}
+
+// Append io and UI state of current context, excluding timestamps and event ids
+static void GetFrameState(ImVector<double>* out_state)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    out_state->push_back(io.MousePos.x);
+    out_state->push_back(io.MousePos.y);
+    out_state->push_back(io.MouseDelta.x);
+    out_state->push_back(io.MouseDelta.y);
+    out_state->push_back(io.MouseWheel);
+    out_state->push_back(io.MouseWheelH);
+    out_state->push_back(io.MouseSource);
+    for (int button = 0; button < ImGuiMouseButton_COUNT; button++)
+    {
+        out_state->push_back(io.MouseDown[button] ? 1.0 : 0.0);
+        out_state->push_back(io.MouseClicked[button] ? 1.0 : 0.0);
+        out_state->push_back(io.MouseReleased[button] ? 1.0 : 0.0);
+        out_state->push_back(io.MouseClickedCount[button]);
+    }
+    out_state->push_back(io.InputQueueCharacters.Size);
+    const ImGuiMousePosSample* samples;
+    const int samples_count = ImGui::GetMousePosSamples(&samples);
+    out_state->push_back(samples_count);
+    for (int n = 0; n < samples_count; n++)
+    {
+        out_state->push_back(samples[n].Pos.x);
+        out_state->push_back(samples[n].Pos.y);
+        out_state->push_back(samples[n].MouseSource);
+    }
+    out_state->push_back(g.HoveredId);
+    out_state->push_back(g.ActiveId);
+    for (ImGuiWindow* window : g.Windows)
+    {
+        out_state->push_back(window->Pos.x);
+        out_state->push_back(window->Pos.y);
+        out_state->push_back(window->Scroll.x);
+        out_state->push_back(window->Scroll.y);
+    }
+}
+
+// Returns number of frames with different states
+static int RunTest(unsigned int test_seed, int frames_count)
+{
+    ImGuiContext* contexts[2] = { CreateTestContext(true), CreateTestContext(false) };
+    TestData data[2];
+    ImVector<double> state[2];
+    int queued_fewer = 0;
+    int errors = 0;
+    unsigned int seed = test_seed;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        const unsigned int frame_seed = TestRand(&seed, 0x7FFFFFFF);
+        for (int ctx_n = 0; ctx_n < 2; ctx_n++)
+        {
+            ImGui::SetCurrentContext(contexts[ctx_n]);
+            unsigned int events_seed = frame_seed;
+            AddRandomEvents(ImGui::GetIO(), &events_seed);
+            ImGui_ImplNull_NewFrame();
+            ImGui::NewFrame();
+            state[ctx_n].resize(0);
+            GetFrameState(&state[ctx_n]);
+            ShowTestFrame(&data[ctx_n]);
+        }
+        if (contexts[0]->InputEventsTrail.Size < contexts[1]->InputEventsTrail.Size)
+            queued_fewer++;
+        if (state[0].Size != state[1].Size || memcmp(state[0].Data, state[1].Data, (size_t)state[0].size_in_bytes()) != 0)
+            if (errors++ == 0)
+                printf("test_mouse_coalescing: seed %u, first difference on frame %d\n", test_seed, frame_n);
+    }
+    printf("test_mouse_coalescing: seed %u, %d frames, %d frames with fewer events, %d errors\n", test_seed, frames_count, queued_fewer, errors);
+
+    for (ImGuiContext* ctx : contexts)
+    {
+        ImGui::SetCurrentContext(ctx);
+        ImGui_ImplNull_Shutdown();
+        ImGui::DestroyContext(ctx);
+    }
+    return (queued_fewer == 0) ? 1 : errors; // Test is meaningless if events were never coalesced
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int seeds_count = 5;
+    int frames_count = 3000;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--seeds=", 8) == 0)
+            seeds_count = ImMax(1, atoi(argv[arg_n] + 8));
+        else if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            frames_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--seeds=N] [--frames=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int failures = 0;
+    for (int seed_n = 0; seed_n < seeds_count; seed_n++)
+        failures += (RunTest(2000u + (unsigned int)seed_n, frames_count) != 0) ? 1 : 0;
+    printf("test_mouse_coalescing: %s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+// Dear ImGui: navigation scoring test
+// NavScoreItemIsCulled() skips scoring candidates which can't beat the current best result.
+// This checks that it never changes results: random layouts are navigated with the same scripted keys twice,
+// scoring every candidate (ImGuiContext::DebugNavScoringNoCull) or not, and NavId/NavWindow/scrolling must be identical on every frame.
+// Layouts mix buttons, selectables, SameLine() rows, dummies, a menu bar and bordered/NavFlattened child windows.
+// Usage:
+//   ./test_nav_scoring [--seeds=N] [--frames=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImGuiContext
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct NavFrameState
+{
+    ImGuiID     NavId;
+    ImGuiID     NavWindowId;
+    float       ScrollY;
+};
+
+// Deterministic pseudo-random numbers (LCG)
+static int TestRand(unsigned int* seed, int n)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (int)((*seed >> 8) % (unsigned int)n);
+}
+
+static void ShowRandomLayout(unsigned int layout_seed)
+{
+    unsigned int seed = layout_seed;
+    char label[16];
+    if (ImGui::BeginMenuBar())
+    {
+        for (int menu_n = 0; menu_n < 4; menu_n++)
+        {
+            snprintf(label, IM_ARRAYSIZE(label), "Menu%d", menu_n);
+            if (ImGui::BeginMenu(label))
+            {
+                ImGui::MenuItem("Item A");
+                ImGui::MenuItem("Item B");
+                ImGui::EndMenu();
+            }
+        }
+        ImGui::EndMenuBar();
+    }
+    const int items_count = 50 + TestRand(&seed, 400);
+    for (int item_n = 0; item_n < items_count; item_n++)
+    {
+        snprintf(label, IM_ARRAYSIZE(label), "b%d", item_n);
+        const int kind = TestRand(&seed, 10);
+        if (kind < 3)
+            ImGui::SameLine(0.0f, (float)TestRand(&seed, 30));
+        if (kind == 9 && TestRand(&seed, 4) == 0)
+        {
+            const ImVec2 child_size((float)(100 + TestRand(&seed, 300)), (float)(50 + TestRand(&seed, 200)));
+            ImGui::BeginChild(label, child_size, ImGuiChildFlags_Borders | (TestRand(&seed, 2) ? ImGuiChildFlags_NavFlattened : 0));
+            const int child_items_count = TestRand(&seed, 40);
+            for (int child_item_n = 0; child_item_n < child_items_count; child_item_n++)
+            {
+                snprintf(label, IM_ARRAYSIZE(label), "c%d", child_item_n);
+                if (TestRand(&seed, 3) == 0)
+                    ImGui::SameLine();
+                ImGui::Button(label, ImVec2((float)(10 + TestRand(&seed, 80)), (float)(10 + TestRand(&seed, 40))));
+            }
+            ImGui::EndChild();
+        }
+        else if (kind == 8)
+            ImGui::Selectable(label);
+        else if (kind == 7)
+            ImGui::Dummy(ImVec2((float)TestRand(&seed, 50), (float)TestRand(&seed, 50)));
+        else
+            ImGui::Button(label, ImVec2((float)(5 + TestRand(&seed, 120)), (float)(5 + TestRand(&seed, 60))));
+    }
+}
+
+// Run scripted navigation over random layouts (layout changes every 300 frames), recording navigation state of each frame.
+static void RunNavScript(unsigned int test_seed, int frames_count, bool no_cull, ImVector<NavFrameState>* out_states)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ctx->DebugNavScoringNoCull = no_cull;
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    ImGui_ImplNull_Init();
+    io.Fonts->AddFontDefault();
+
+    static const ImGuiKey keys[] = { ImGuiKey_DownArrow, ImGuiKey_DownArrow, ImGuiKey_RightArrow, ImGuiKey_DownArrow, ImGuiKey_UpArrow, ImGuiKey_LeftArrow, ImGuiKey_RightArrow, ImGuiKey_PageDown, ImGuiKey_PageUp, ImGuiKey_Home, ImGuiKey_End, ImGuiKey_Tab };
+    unsigned int keys_seed = test_seed;
+    ImGuiKey key_held = ImGuiKey_None;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        // Press a key every other frame. First half of each layout only uses arrows.
+        if (key_held != ImGuiKey_None)
+        {
+            io.AddKeyEvent(key_held, false);
+            key_held = ImGuiKey_None;
+        }
+        else if (frame_n > 3)
+        {
+            key_held = keys[TestRand(&keys_seed, (frame_n % 300 < 150) ? 7 : IM_ARRAYSIZE(keys))];
+            io.AddKeyEvent(key_held, true);
+        }
+
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(600.0f, 500.0f), ImGuiCond_Once);
+        ImGui::Begin("Test", NULL, ImGuiWindowFlags_MenuBar);
+        if (frame_n == 2 || frame_n % 300 == 1)
+            ImGui::SetKeyboardFocusHere();
+        ShowRandomLayout(test_seed * 7919 + (unsigned int)(frame_n / 300));
+        ImGui::End();
+        ImGui::Render();
+        ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+
+        NavFrameState state;
+        state.NavId = ctx->NavId;
+        state.NavWindowId = ctx->NavWindow ? ctx->NavWindow->ID : 0;
+        state.ScrollY = ctx->NavWindow ? ctx->NavWindow->Scroll.y : -1.0f;
+        out_states->push_back(state);
+    }
+
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext(ctx);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int seeds_count = 10;
+    int frames_count = 1500;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--seeds=", 8) == 0)
+            seeds_count = ImMax(1, atoi(argv[arg_n] + 8));
+        else if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            frames_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--seeds=N] [--frames=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int failures = 0;
+    int nav_id_changes = 0;
+    for (int seed_n = 1; seed_n <= seeds_count; seed_n++)
+    {
+        ImVector<NavFrameState> states_culled, states_all;
+        RunNavScript((unsigned int)seed_n, frames_count, false, &states_culled);
+        RunNavScript((unsigned int)seed_n, frames_count, true, &states_all);
+        for (int frame_n = 0; frame_n < frames_count; frame_n++)
+        {
+            const NavFrameState& a = states_culled[frame_n];
+            const NavFrameState& b = states_all[frame_n];
+            if (frame_n > 0 && a.NavId != states_culled[frame_n - 1].NavId)
+                nav_id_changes++;
+            if (a.NavId != b.NavId || a.NavWindowId != b.NavWindowId || a.ScrollY != b.ScrollY)
+            {
+                fprintf(stderr, "seed %d frame %d: culled NavId 0x%08X window 0x%08X scroll %.1f != unculled NavId 0x%08X window 0x%08X scroll %.1f\n",
+                    seed_n, frame_n, a.NavId, a.NavWindowId, a.ScrollY, b.NavId, b.NavWindowId, b.ScrollY);
+                failures++;
+                break;
+            }
+        }
+    }
+    if (nav_id_changes == 0)
+    {
+        fprintf(stderr, "navigation never moved: test script is broken.\n");
+        failures++;
+    }
+    printf("test_nav_scoring: %d seeds, %d frames, %d NavId changes: %s\n", seeds_count, frames_count, nav_id_changes, failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,275 @@
+// Dear ImGui: text line cache test
+// TextUnformattedAppendOnly() keeps a line index of large buffers, validated every frame against a copy of the text laid out.
+// Two contexts display the same buffer, one with TextUnformattedAppendOnly() and one with TextUnformatted(), while the buffer is
+// appended to, modified in place (same size), truncated and cleared, with and without wrapping, at random widths, font sizes
+// and scrolling positions. Item sizes and visible triangles must be identical on every frame. (Lines fully outside of the clipping
+// rectangle may or may not be output, as both paths don't clip the same way.)
+// Wrapped text and inactive multi-line InputText() with word-wrapping use line indices cached by contents (ImFontWrapLayout):
+// the buffer is also displayed in a read-only InputTextMultiline(), along with short wrapped texts of random words, punctuation,
+// blanks and UTF-8 characters, which are compared with a walk over the whole text (ImGuiContext::DebugTextLineCacheCheck).
+// Usage:
+//   ./test_text_line_cache [--seeds=N] [--frames=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImGuiContext
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Deterministic pseudo-random numbers (LCG)
+static int TestRand(unsigned int* seed, int n)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (int)((*seed >> 8) % (unsigned int)n);
+}
+
+static ImGuiContext* CreateTestContext()
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1280.0f, 800.0f);
+    ImGui_ImplNull_Init();
+    return ctx;
+}
+
+// Append lines of random words, sometimes long ones to be wrapped, sometimes empty ones
+static void AppendRandomLines(ImGuiTextBuffer* buf, unsigned int* seed, int lines_count)
+{
+    for (int line_n = 0; line_n < lines_count; line_n++)
+    {
+        const int words_count = (TestRand(seed, 8) == 0) ? 0 : 1 + TestRand(seed, (TestRand(seed, 6) == 0) ? 60 : 10);
+        for (int word_n = 0; word_n < words_count; word_n++)
+        {
+            char word[16];
+            const int len = 1 + TestRand(seed, 12);
+            for (int n = 0; n < len; n++)
+                word[n] = (char)('a' + TestRand(seed, 26));
+            word[len] = 0;
+            buf->appendf("%s%s", word, TestRand(seed, 5) == 0 ? "  " : " ");
+        }
+        if (TestRand(seed, 10) != 0) // Sometimes leave last line open, to be extended by next append
+            buf->append("\n");
+    }
+}
+
+// Modify buffer between frames. Returns a short description for error reports.
+static const char* ModifyBuffer(ImGuiTextBuffer* buf, unsigned int* seed)
+{
+    const int kind = TestRand(seed, 20);
+    if (kind < 10)
+    {
+        AppendRandomLines(buf, seed, 1 + TestRand(seed, 20));
+        return "append";
+    }
+    if (kind < 16 && buf->size() > 0)
+    {
+        // In-place modification keeping the same size, anywhere in the buffer (including the middle, which hashes of head/tail bytes wouldn't see)
+        static const char replacements[] = "\n aZ.";
+        const int count = 1 + TestRand(seed, 3);
+        for (int n = 0; n < count; n++)
+            buf->Buf[TestRand(seed, buf->size())] = replacements[TestRand(seed, IM_ARRAYSIZE(replacements) - 1)];
+        return "modify";
+    }
+    if (kind < 19 && buf->size() > 0)
+    {
+        const int new_size = TestRand(seed, buf->size());
+        buf->Buf.resize(new_size + 1);
+        buf->Buf[new_size] = 0;
+        return "truncate";
+    }
+    buf->clear();
+    AppendRandomLines(buf, seed, 50 + TestRand(seed, 200));
+    return "clear";
+}
+
+// Short text with word separators and characters of various widths
+static void MakeRandomText(ImVector<char>* out_text, unsigned int* seed)
+{
+    static const unsigned int chars[] = { ' ', ' ', ' ', '\t', 0x3000, '\n', '\r', '.', ',', ';', '!', '?', '"', 0x3001, 0x3002, 0xE9, 0x4E00, 0x4E8C, 'W', 'i' };
+    out_text->resize(0);
+    const int len = TestRand(seed, 300);
+    for (int n = 0; n < len; n++)
+    {
+        const int char_n = TestRand(seed, IM_ARRAYSIZE(chars) * 3);
+        const unsigned int c = (char_n < IM_ARRAYSIZE(chars)) ? chars[char_n] : 'a' + TestRand(seed, 26);
+        char utf8[5];
+        const int utf8_len = ImTextCharToUtf8(utf8, c);
+        for (int byte_n = 0; byte_n < utf8_len; byte_n++)
+            out_text->push_back(utf8[byte_n]);
+    }
+    out_text->push_back(0);
+}
+
+struct TestFrameParams
+{
+    bool        Wrap;
+    float       Width;
+    float       FontSize;
+    float       ScrollY;
+    int         WrappedTextsCount;
+    float       WrapPos[8];
+};
+
+// Append item size and vertices of triangles overlapping their clipping rectangle
+static void ShowTestFrame(ImGuiTextBuffer& buf, const ImVector<char>* wrapped_texts, const TestFrameParams& params, bool append_only, ImVector<float>* out_state)
+{
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(params.Width, 700.0f));
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, params.ScrollY));
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PushFont(NULL, params.FontSize);
+    if (params.Wrap)
+        ImGui::PushTextWrapPos(0.0f);
+    if (append_only)
+        ImGui::TextUnformattedAppendOnly(buf.begin(), buf.end());
+    else
+        ImGui::TextUnformatted(buf.begin(), buf.end());
+    const ImVec2 item_size = ImGui::GetItemRectSize();
+    if (params.Wrap)
+        ImGui::PopTextWrapPos();
+    ImGui::PopFont();
+    ImGui::End();
+
+    // Wrapped texts, some of them laid out at two widths. Many of them at once on some frames, to grow the cache.
+    ImGui::SetNextWindowPos(ImVec2(700.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(500.0f, 700.0f));
+    ImGui::Begin("Wrapped", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PushFont(NULL, params.FontSize);
+    if (buf.size() > 0)
+        ImGui::InputTextMultiline("##buf", buf.Buf.Data, (size_t)buf.Buf.Size, ImVec2(params.WrapPos[0], 200.0f), ImGuiInputTextFlags_ReadOnly | ImGuiInputTextFlags_WordWrap);
+    for (int text_n = 0; text_n < params.WrappedTextsCount; text_n++)
+    {
+        const ImVector<char>& text = wrapped_texts[text_n % 8];
+        for (int layout_n = 0; layout_n < ((text_n % 3 == 0) ? 2 : 1); layout_n++)
+        {
+            ImGui::PushID(text_n);
+            ImGui::PushTextWrapPos(params.WrapPos[(text_n + layout_n) % 8]);
+            if (text_n < 8)
+                ImGui::TextUnformatted(text.begin(), text.end() - 1);
+            else
+                ImGui::Text("%d %s", text_n, text.Data); // Formatted: distinct contents at a same address
+            ImGui::PopTextWrapPos();
+            ImGui::PopID();
+        }
+    }
+    ImGui::PopFont();
+    ImGui::End();
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+
+    out_state->push_back(item_size.x);
+    out_state->push_back(item_size.y);
+    for (ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n += 3)
+            {
+                const ImDrawVert* vtx[3];
+                ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (int n = 0; n < 3; n++)
+                {
+                    vtx[n] = &draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[idx_n + n]];
+                    bb.Add(vtx[n]->pos);
+                }
+                if (!bb.Overlaps(ImRect(cmd.ClipRect)))
+                    continue;
+                for (int n = 0; n < 3; n++)
+                {
+                    out_state->push_back(vtx[n]->pos.x);
+                    out_state->push_back(vtx[n]->pos.y);
+                    out_state->push_back(vtx[n]->uv.x);
+                    out_state->push_back(vtx[n]->uv.y);
+                }
+            }
+}
+
+// Returns number of frames with different states
+static int RunTest(unsigned int test_seed, int frames_count)
+{
+    ImGuiContext* contexts[2] = { CreateTestContext(), CreateTestContext() };
+    ImVector<float> state[2];
+    unsigned int seed = test_seed;
+    ImGuiTextBuffer buf;
+    AppendRandomLines(&buf, &seed, 200);
+    ImVector<char> wrapped_texts[8];
+    for (ImVector<char>& text : wrapped_texts)
+        MakeRandomText(&text, &seed);
+    TestFrameParams params = { false, 600.0f, 13.0f, 0.0f, 8, {} };
+    for (float& wrap_pos : params.WrapPos)
+        wrap_pos = 20.0f + TestRand(&seed, 480);
+    for (ImGuiContext* ctx : contexts)
+        ctx->DebugTextLineCacheCheck = true;
+    int max_wrap_caches = 0;
+    int errors = 0;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        const char* modification = "none";
+        if (TestRand(&seed, 3) == 0)
+            modification = ModifyBuffer(&buf, &seed);
+        if (TestRand(&seed, 40) == 0)
+            params.Wrap = !params.Wrap;
+        if (TestRand(&seed, 20) == 0)
+            params.Width = 100.0f + TestRand(&seed, 1000);
+        if (TestRand(&seed, 60) == 0)
+            params.FontSize = 10.0f + TestRand(&seed, 20);
+        if (TestRand(&seed, 4) == 0)
+            params.ScrollY = (TestRand(&seed, 4) == 0) ? FLT_MAX : (float)TestRand(&seed, 20000);
+        if (TestRand(&seed, 4) == 0)
+            MakeRandomText(&wrapped_texts[TestRand(&seed, 8)], &seed);
+        if (TestRand(&seed, 10) == 0)
+            params.WrapPos[TestRand(&seed, 8)] = 20.0f + TestRand(&seed, 480);
+        params.WrappedTextsCount = (TestRand(&seed, 100) == 0) ? 400 : 8;
+
+        for (int ctx_n = 0; ctx_n < 2; ctx_n++)
+        {
+            ImGui::SetCurrentContext(contexts[ctx_n]);
+            state[ctx_n].resize(0);
+            ShowTestFrame(buf, wrapped_texts, params, ctx_n == 0, &state[ctx_n]);
+        }
+        max_wrap_caches = ImMax(max_wrap_caches, contexts[0]->TextWrapCaches.Size);
+        if (state[0].Size != state[1].Size || memcmp(state[0].Data, state[1].Data, (size_t)state[0].size_in_bytes()) != 0)
+            if (errors++ == 0)
+                printf("test_text_line_cache: seed %u, first difference on frame %d (after '%s', wrap %d, width %.0f, font size %.0f)\n", test_seed, frame_n, modification, params.Wrap, params.Width, params.FontSize);
+    }
+    const int wrap_errors = contexts[0]->DebugTextLineCacheErrors + contexts[1]->DebugTextLineCacheErrors;
+    printf("test_text_line_cache: seed %u, %d frames, text length %d, %d wrap cache entries, %d errors, %d wrap errors\n", test_seed, frames_count, buf.size(), max_wrap_caches, errors, wrap_errors);
+
+    const int caches_count = contexts[0]->TextLineCaches.GetAliveCount();
+    for (ImGuiContext* ctx : contexts)
+    {
+        ImGui::SetCurrentContext(ctx);
+        ImGui_ImplNull_Shutdown();
+        ImGui::DestroyContext(ctx);
+    }
+    return (caches_count == 0 || max_wrap_caches <= 64) ? 1 : errors + wrap_errors; // Test is meaningless if caches were never used or grown
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int seeds_count = 5;
+    int frames_count = 2000;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--seeds=", 8) == 0)
+            seeds_count = ImMax(1, atoi(argv[arg_n] + 8));
+        else if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            frames_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--seeds=N] [--frames=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int failures = 0;
+    for (int seed_n = 0; seed_n < seeds_count; seed_n++)
+        failures += (RunTest(3000u + (unsigned int)seed_n, frames_count) != 0) ? 1 : 0;
+    printf("test_text_line_cache: %s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,219 @@
+// Dear ImGui: texture block functions test
+// ImFontAtlasTextureBlockConvert(), ImFontAtlasTextureBlockPostProcessMultiply(), ImFontAtlasTextureBlockFill() and ImFontAtlasTextureBlockCopy()
+// have SSE2 paths (when IMGUI_ENABLE_SSE2 is defined) processing 4 or 16 pixels at a time, followed by a scalar loop for remaining pixels.
+// This checks them against reference scalar implementations, on random sizes, pitches, unaligned addresses and edges,
+// and that pixels outside of the destination block are never written to.
+// Build with 'make SCALAR=1' to test the scalar paths instead (run 'make clean' when switching, objects are shared).
+// Usage:
+//   ./test_texture_blocks [--iterations=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImFontAtlasTextureBlockXXX()
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int g_Failures = 0;
+
+// Deterministic pseudo-random numbers (LCG)
+static int TestRand(unsigned int* seed, int n)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (int)((*seed >> 8) % (unsigned int)n);
+}
+
+static void FillRandom(unsigned int* seed, unsigned char* p, int size)
+{
+    for (int n = 0; n < size; n++)
+        p[n] = (unsigned char)TestRand(seed, 256);
+}
+
+static void CheckEqual(const char* func_name, int iteration, const unsigned char* a, const unsigned char* b, int size)
+{
+    if (memcmp(a, b, (size_t)size) == 0)
+        return;
+    int offset = 0;
+    while (a[offset] == b[offset])
+        offset++;
+    if (g_Failures++ < 10)
+        printf("test_texture_blocks: %s() mismatch at iteration %d, byte offset %d: %d != %d\n", func_name, iteration, offset, a[offset], b[offset]);
+}
+
+//-----------------------------------------------------------------------------
+// Reference implementations
+//-----------------------------------------------------------------------------
+
+static ImU32 ReadU32(const unsigned char* p)     { ImU32 v; memcpy(&v, p, 4); return v; }
+static void  WriteU32(unsigned char* p, ImU32 v) { memcpy(p, &v, 4); }
+
+static void RefBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
+{
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+        {
+            const unsigned char* src_p = src_pixels + y * src_pitch + x * ImTextureDataGetFormatBytesPerPixel(src_fmt);
+            unsigned char* dst_p = dst_pixels + y * dst_pitch + x * ImTextureDataGetFormatBytesPerPixel(dst_fmt);
+            if (src_fmt == dst_fmt)
+                memcpy(dst_p, src_p, (size_t)ImTextureDataGetFormatBytesPerPixel(src_fmt));
+            else if (src_fmt == ImTextureFormat_Alpha8)
+                WriteU32(dst_p, IM_COL32(255, 255, 255, *src_p));
+            else
+                *dst_p = (unsigned char)((ReadU32(src_p) >> IM_COL32_A_SHIFT) & 0xFF);
+        }
+}
+
+static void RefBlockMultiply(unsigned char* pixels, ImTextureFormat fmt, int pitch, int w, int h, float multiply_factor)
+{
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+        {
+            if (fmt == ImTextureFormat_Alpha8)
+            {
+                unsigned char* p = pixels + y * pitch + x;
+                *p = (unsigned char)ImMin((unsigned int)(*p * multiply_factor), (unsigned int)255);
+            }
+            else
+            {
+                unsigned char* p = pixels + y * pitch + x * 4;
+                const ImU32 col = ReadU32(p);
+                const unsigned int a = ImMin((unsigned int)(((col >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
+                WriteU32(p, (col & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT));
+            }
+        }
+}
+
+static void RefBlockFill(ImTextureData* tex, int dst_x, int dst_y, int w, int h, ImU32 col)
+{
+    for (int y = dst_y; y < dst_y + h; y++)
+        for (int x = dst_x; x < dst_x + w; x++)
+        {
+            unsigned char* p = (unsigned char*)tex->GetPixelsAt(x, y);
+            if (tex->Format == ImTextureFormat_Alpha8)
+                *p = (unsigned char)((col >> IM_COL32_A_SHIFT) & 0xFF);
+            else
+                WriteU32(p, col);
+        }
+}
+
+//-----------------------------------------------------------------------------
+// Tests
+//-----------------------------------------------------------------------------
+
+// Random size, plus a random pitch padding and a random start offset, within a buffer with guard bytes on each side.
+// RGBA32 addresses are kept 4-bytes aligned as functions access them as ImU32, but not 16-bytes aligned.
+struct TestBlock
+{
+    ImVector<unsigned char> Buffer;
+    int                     Offset;
+    int                     Pitch;
+    unsigned char*          Pixels() { return Buffer.Data + Offset; }
+
+    void Init(unsigned int* seed, ImTextureFormat fmt, int w, int h)
+    {
+        const int bpp = ImTextureDataGetFormatBytesPerPixel(fmt);
+        Pitch = (w + TestRand(seed, 20)) * bpp;
+        Offset = 64 + TestRand(seed, 16) * ((bpp == 1) ? 1 : 4);
+        Buffer.resize(Offset + Pitch * h + 64);
+        FillRandom(seed, Buffer.Data, Buffer.Size);
+    }
+};
+
+static void TestBlockConvert(unsigned int* seed, int iteration)
+{
+    static const ImTextureFormat formats[][2] = { { ImTextureFormat_Alpha8, ImTextureFormat_RGBA32 }, { ImTextureFormat_RGBA32, ImTextureFormat_Alpha8 }, { ImTextureFormat_Alpha8, ImTextureFormat_Alpha8 }, { ImTextureFormat_RGBA32, ImTextureFormat_RGBA32 } };
+    const ImTextureFormat src_fmt = formats[iteration % 4][0];
+    const ImTextureFormat dst_fmt = formats[iteration % 4][1];
+    const int w = TestRand(seed, 70);
+    const int h = 1 + TestRand(seed, 8);
+    TestBlock src, dst;
+    src.Init(seed, src_fmt, w, h);
+    dst.Init(seed, dst_fmt, w, h);
+    ImVector<unsigned char> expected = dst.Buffer;
+    RefBlockConvert(src.Pixels(), src_fmt, src.Pitch, expected.Data + dst.Offset, dst_fmt, dst.Pitch, w, h);
+    ImFontAtlasTextureBlockConvert(src.Pixels(), src_fmt, src.Pitch, dst.Pixels(), dst_fmt, dst.Pitch, w, h);
+    CheckEqual("ImFontAtlasTextureBlockConvert", iteration, expected.Data, dst.Buffer.Data, expected.Size);
+}
+
+static void TestBlockPostProcessMultiply(unsigned int* seed, int iteration)
+{
+    const ImTextureFormat fmt = (iteration & 1) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+    const int w = TestRand(seed, 70);
+    const int h = 1 + TestRand(seed, 8);
+    const float multiply_factor = (TestRand(seed, 4) == 0) ? (float)TestRand(seed, 3) : TestRand(seed, 4000) / 1000.0f;
+    TestBlock block;
+    block.Init(seed, fmt, w, h);
+    ImVector<unsigned char> expected = block.Buffer;
+    RefBlockMultiply(expected.Data + block.Offset, fmt, block.Pitch, w, h, multiply_factor);
+    ImFontAtlasPostProcessData data = {};
+    data.Pixels = block.Pixels();
+    data.Format = fmt;
+    data.Pitch = block.Pitch;
+    data.Width = w;
+    data.Height = h;
+    ImFontAtlasTextureBlockPostProcessMultiply(&data, multiply_factor);
+    CheckEqual("ImFontAtlasTextureBlockPostProcessMultiply", iteration, expected.Data, block.Buffer.Data, expected.Size);
+}
+
+// Blocks at random positions in textures of random sizes: guard pixels are the rest of the texture.
+static void TestBlockFillCopy(unsigned int* seed, int iteration)
+{
+    const ImTextureFormat fmt = (iteration & 1) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+    ImTextureData src_tex, dst_tex, expected_tex;
+    src_tex.Create(fmt, 1 + TestRand(seed, 90), 1 + TestRand(seed, 12));
+    dst_tex.Create(fmt, 1 + TestRand(seed, 90), 1 + TestRand(seed, 12));
+    expected_tex.Create(fmt, dst_tex.Width, dst_tex.Height);
+    FillRandom(seed, src_tex.Pixels, src_tex.GetSizeInBytes());
+    FillRandom(seed, dst_tex.Pixels, dst_tex.GetSizeInBytes());
+    memcpy(expected_tex.Pixels, dst_tex.Pixels, (size_t)dst_tex.GetSizeInBytes());
+
+    const int w = TestRand(seed, ImMin(src_tex.Width, dst_tex.Width) + 1);
+    const int h = TestRand(seed, ImMin(src_tex.Height, dst_tex.Height) + 1);
+    const int src_x = TestRand(seed, src_tex.Width - w + 1);
+    const int src_y = TestRand(seed, src_tex.Height - h + 1);
+    const int dst_x = TestRand(seed, dst_tex.Width - w + 1);
+    const int dst_y = TestRand(seed, dst_tex.Height - h + 1);
+    if (iteration & 2)
+    {
+        const ImU32 col = (ImU32)TestRand(seed, 1 << 16) | ((ImU32)TestRand(seed, 1 << 16) << 16);
+        RefBlockFill(&expected_tex, dst_x, dst_y, w, h, col);
+        ImFontAtlasTextureBlockFill(&dst_tex, dst_x, dst_y, w, h, col);
+        CheckEqual("ImFontAtlasTextureBlockFill", iteration, expected_tex.Pixels, dst_tex.Pixels, dst_tex.GetSizeInBytes());
+    }
+    else
+    {
+        RefBlockConvert((unsigned char*)src_tex.GetPixelsAt(src_x, src_y), fmt, src_tex.GetPitch(), (unsigned char*)expected_tex.GetPixelsAt(dst_x, dst_y), fmt, expected_tex.GetPitch(), w, h);
+        ImFontAtlasTextureBlockCopy(&src_tex, src_x, src_y, &dst_tex, dst_x, dst_y, w, h);
+        CheckEqual("ImFontAtlasTextureBlockCopy", iteration, expected_tex.Pixels, dst_tex.Pixels, dst_tex.GetSizeInBytes());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int iterations_count = 20000;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--iterations=", 13) == 0)
+            iterations_count = ImMax(1, atoi(argv[arg_n] + 13));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--iterations=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    unsigned int seed = 1234;
+    for (int iteration = 0; iteration < iterations_count; iteration++)
+    {
+        TestBlockConvert(&seed, iteration);
+        TestBlockPostProcessMultiply(&seed, iteration);
+        TestBlockFillCopy(&seed, iteration);
+    }
+#ifdef IMGUI_ENABLE_SSE2
+    const char* path_name = "SSE2";
+#else
+    const char* path_name = "scalar";
+#endif
+    printf("test_texture_blocks: %d iterations, %s path: %s\n", iterations_count, path_name, g_Failures ? "FAILED" : "OK");
+    return g_Failures ? 1 : 0;
+}
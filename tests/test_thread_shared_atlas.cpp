@@ -0,0 +1,262 @@
+// Dear ImGui: thread-shared font atlas stress test
+// N contexts running on N threads share one atlas (ImFontAtlasFlags_ThreadShared), while M other threads run contexts with their own atlas.
+// Frames use random fonts, sizes and codepoints, so readers keep requesting glyphs and sizes while the atlas is updated concurrently.
+// Both ownership modes are tested: atlas owned by a context running its frames on the main thread, and atlas created by the application
+// (updated with ImFontAtlasUpdateNewFrame(), textures processed from atlas->TexList[]). In the latter mode, once requests have been baked,
+// a frame rendered through the shared atlas must match the same frame rendered with an independent atlas.
+// Requires IMGUI_ENABLE_THREAD_LOCAL_CONTEXT (set by the Makefile). Build with 'make TSAN=1' to run it under ThreadSanitizer.
+// Usage:
+//   ./test_thread_shared_atlas [--shared=N] [--independent=N] [--frames=N]
+
+#include "imgui.h"
+#include "imgui_internal.h"         // ImFontAtlasUpdateNewFrame(), ImFontAtlasBuilder, UnlockFontAtlases()
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#ifndef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#error "This test requires IMGUI_ENABLE_THREAD_LOCAL_CONTEXT."
+#endif
+
+#ifndef IMGUI_TESTS_FONTS_DIR
+#define IMGUI_TESTS_FONTS_DIR "../misc/fonts"
+#endif
+
+static std::atomic<int> g_FramesDone(0);
+static std::atomic<int> g_Failures(0);
+
+// Deterministic pseudo-random numbers (LCG)
+static unsigned int TestRand(unsigned int* seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+static void AddTestFonts(ImFontAtlas* atlas)
+{
+    atlas->AddFontDefault();
+    if (atlas->AddFontFromFileTTF(IMGUI_TESTS_FONTS_DIR "/DroidSans.ttf") == NULL)
+        g_Failures++;
+}
+
+static void UpdateTextures(ImVector<ImTextureData*>& textures)
+{
+    for (ImTextureData* tex : textures)
+        if (tex->Status != ImTextureStatus_OK)
+            ImGui_ImplNullRender_UpdateTexture(tex);
+}
+
+static ImGuiContext* CreateTestContext(ImFontAtlas* shared_atlas)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(shared_atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1280.0f, 800.0f);
+    ImGui_ImplNull_Init();
+    if (shared_atlas == NULL)
+        AddTestFonts(io.Fonts);
+    return ctx;
+}
+
+static void DestroyTestContext(ImGuiContext* ctx)
+{
+    ImGui::SetCurrentContext(ctx);
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext(ctx);
+}
+
+// Windows with random text using random fonts, sizes and codepoints (Latin + some CJK, which fonts don't have: fallback glyphs)
+static void ShowTestFrame(unsigned int* seed, int frame_n)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddMousePosEvent((float)(TestRand(seed) % 1200), (float)(TestRand(seed) % 800));
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ImFontAtlas* atlas = io.Fonts;
+    static const float font_sizes[] = { 10.0f, 13.0f, 16.0f, 20.0f, 28.0f, 40.0f };
+    for (int window_n = 0; window_n < 4; window_n++)
+    {
+        char label[32];
+        snprintf(label, IM_ARRAYSIZE(label), "Window %d", window_n);
+        ImGui::SetNextWindowPos(ImVec2((float)(window_n * 250), 10.0f), ImGuiCond_Once);
+        ImGui::Begin(label);
+        for (int line_n = 0; line_n < 8; line_n++)
+        {
+            ImGui::PushFont(atlas->Fonts[TestRand(seed) % atlas->Fonts.Size], font_sizes[TestRand(seed) % IM_ARRAYSIZE(font_sizes)]);
+            char buf[256];
+            char* p = buf;
+            const int len = 5 + TestRand(seed) % 30;
+            for (int char_n = 0; char_n < len; char_n++)
+                p += ImTextCharToUtf8(p, (TestRand(seed) % 4 == 0) ? (0x4E00 + TestRand(seed) % 2000) : (0x20 + TestRand(seed) % 0x260));
+            *p = 0;
+            if (line_n & 1)
+                ImGui::TextWrapped("%s", buf);
+            else
+                ImGui::TextUnformatted(buf);
+            if (TestRand(seed) % 8 == 0)
+                ImGui::GetFont()->IsGlyphInFont((ImWchar)(0x20 + TestRand(seed) % 0x300));
+            ImGui::PopFont();
+        }
+        if (ImGui::BeginTable("table", 3))
+        {
+            for (int row_n = 0; row_n < 10; row_n++)
+            {
+                ImGui::TableNextRow();
+                for (int column_n = 0; column_n < 3; column_n++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d,%d %d", row_n, column_n, frame_n);
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::Button("\xc3\xa9l\xc3\xa8ve"); // "élève"
+        ImGui::End();
+    }
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+}
+
+// Thread function. 'shared_atlas' == NULL: context with its own atlas.
+static void RunWorker(ImFontAtlas* shared_atlas, unsigned int seed, int frames_count)
+{
+    ImGuiContext* ctx = CreateTestContext(shared_atlas);
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        ShowTestFrame(&seed, frame_n);
+        if (shared_atlas != NULL && ImGui::GetPlatformIO().Textures.Size != 0) // Only the owner context may list atlas textures
+            g_Failures++;
+        if (shared_atlas != NULL && ImGui::GetCurrentContext()->FontAtlasesLocked.Size != 1) // Read lock is held until next NewFrame(), as draw data refers to the atlas
+            g_Failures++;
+        g_FramesDone++;
+    }
+    DestroyTestContext(ctx);
+}
+
+// Render a same frame a few times, return a checksum of vertices positions of the last one.
+// Atlas is updated before each frame, so glyphs requested by a frame are baked for the next one.
+static unsigned int RenderChecksum(ImFontAtlas* atlas, int* atlas_frame_count)
+{
+    ImGuiContext* ctx = CreateTestContext(atlas);
+    unsigned int checksum = 0;
+    for (int n = 0; n < 4; n++)
+    {
+        ImFontAtlasUpdateNewFrame(atlas, (*atlas_frame_count)++, true);
+        UpdateTextures(atlas->TexList);
+        unsigned int seed = 99;
+        ShowTestFrame(&seed, 0);
+        checksum = 0;
+        for (ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+            for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+                checksum = checksum * 31 + (unsigned int)(vtx.pos.x * 4) + (unsigned int)(vtx.pos.y * 4) * 7;
+        ImGui::UnlockFontAtlases(); // Done with draw data. Required as next ImFontAtlasUpdateNewFrame() call is on this thread.
+    }
+    DestroyTestContext(ctx);
+    return checksum;
+}
+
+static void RunTest(bool owner_mode, int shared_count, int independent_count, int frames_count)
+{
+    // Create shared atlas
+    ImGuiContext* main_ctx;
+    ImFontAtlas* atlas;
+    int atlas_frame_count = 1;
+    if (owner_mode)
+    {
+        main_ctx = CreateTestContext(NULL); // Atlas owned by this context, updated by its NewFrame()
+        atlas = ImGui::GetIO().Fonts;
+    }
+    else
+    {
+        atlas = IM_NEW(ImFontAtlas)();
+        AddTestFonts(atlas);
+        main_ctx = CreateTestContext(atlas); // Keep atlas alive: it is destroyed with the last context using it
+    }
+    atlas->Flags |= ImFontAtlasFlags_ThreadShared;
+    unsigned int main_seed = 77;
+    if (owner_mode)
+        ShowTestFrame(&main_seed, 0);
+    else
+    {
+        ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true);
+        UpdateTextures(atlas->TexList);
+    }
+
+    g_FramesDone = 0;
+    std::vector<std::thread> threads;
+    for (int n = 0; n < shared_count; n++)
+        threads.emplace_back(RunWorker, atlas, 1234u + n, frames_count);
+    for (int n = 0; n < independent_count; n++)
+        threads.emplace_back(RunWorker, (ImFontAtlas*)NULL, 5678u + n, frames_count);
+
+    // Update atlas from main thread, concurrently with workers' frames
+    int atlas_updates = 0;
+    while (g_FramesDone < (shared_count + independent_count) * frames_count)
+    {
+        if (owner_mode)
+        {
+            ImGui::SetCurrentContext(main_ctx);
+            ShowTestFrame(&main_seed, atlas_updates);
+        }
+        else
+        {
+            ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true);
+            UpdateTextures(atlas->TexList);
+        }
+        atlas_updates++;
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Compare a frame rendered through the shared atlas with one rendered with an independent atlas
+    const char* checksum_result = "n/a";
+    if (!owner_mode)
+    {
+        const unsigned int checksum_shared = RenderChecksum(atlas, &atlas_frame_count);
+        ImFontAtlas* independent_atlas = IM_NEW(ImFontAtlas)();
+        AddTestFonts(independent_atlas);
+        int independent_atlas_frame_count = 1;
+        const unsigned int checksum_independent = RenderChecksum(independent_atlas, &independent_atlas_frame_count);
+        checksum_result = (checksum_shared == checksum_independent) ? "match" : "MISMATCH";
+        if (checksum_shared != checksum_independent)
+            g_Failures++;
+    }
+    printf("test_thread_shared_atlas: %s atlas, %d shared + %d independent contexts, %d atlas updates, %d baked sizes, checksum %s\n",
+        owner_mode ? "context-owned" : "user-created", shared_count, independent_count, atlas_updates, atlas->Builder->BakedPool.Size, checksum_result);
+    DestroyTestContext(main_ctx);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int shared_count = 4;
+    int independent_count = 2;
+    int frames_count = 60;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--shared=", 9) == 0)
+            shared_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else if (strncmp(argv[arg_n], "--independent=", 14) == 0)
+            independent_count = ImMax(0, atoi(argv[arg_n] + 14));
+        else if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            frames_count = ImMax(1, atoi(argv[arg_n] + 9));
+        else
+        {
+            fprintf(stderr, "Usage: %s [--shared=N] [--independent=N] [--frames=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    RunTest(true, shared_count, independent_count, frames_count);
+    RunTest(false, shared_count, independent_count, frames_count);
+    printf("test_thread_shared_atlas: %s\n", g_Failures ? "FAILED" : "OK");
+    return g_Failures ? 1 : 0;
+}